@@ -0,0 +1,35 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "AsyncTasks/Engine/Contract/AsyncTaskContractReadBatch.h"
+
+#include "Components/SlateWrapperTypes.h"
+#include "Engine/ThirdwebEngine.h"
+
+UAsyncTaskContractReadBatch* UAsyncTaskContractReadBatch::ReadContractBatch(UObject* WorldContextObject, const TArray<FThirdwebEngineContractCall>& Calls)
+{
+	NEW_TASK
+	Task->Calls = Calls;
+	RR_TASK
+}
+
+void UAsyncTaskContractReadBatch::Activate()
+{
+	ThirdwebEngine::Contract::ReadBatch(
+		this,
+		Calls,
+		BIND_UOBJECT_DELEGATE(ThirdwebEngine::Contract::FReadBatchDelegate, HandleResponse),
+		BIND_UOBJECT_DELEGATE(FStringDelegate, HandleFailed)
+	);
+}
+
+void UAsyncTaskContractReadBatch::HandleResponse(const TArray<FThirdwebEngineContractCallResult>& Results)
+{
+	Success.Broadcast(Results, TEXT(""));
+	SetReadyToDestroy();
+}
+
+void UAsyncTaskContractReadBatch::HandleFailed(const FString& Error)
+{
+	Failed.Broadcast({}, Error);
+	SetReadyToDestroy();
+}
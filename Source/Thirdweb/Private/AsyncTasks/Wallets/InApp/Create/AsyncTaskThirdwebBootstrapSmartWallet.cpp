@@ -0,0 +1,57 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "AsyncTasks/Wallets/InApp/Create/AsyncTaskThirdwebBootstrapSmartWallet.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "Wallets/ThirdwebSmartWalletHandle.h"
+
+void UAsyncTaskThirdwebBootstrapSmartWallet::Activate()
+{
+	FSmartWalletHandle::Bootstrap(
+		InAppWallet,
+		ChainID,
+		bGasless,
+		Factory,
+		AccountOverride,
+		BIND_UOBJECT_DELEGATE(FSmartWalletHandle::FBootstrapDelegate, HandleResponse),
+		BIND_UOBJECT_DELEGATE(FStringDelegate, HandleFailed)
+	);
+}
+
+void UAsyncTaskThirdwebBootstrapSmartWallet::HandleResponse(const FThirdwebWalletBootstrapResult& Result)
+{
+	if (!IsInGameThread())
+	{
+		TWeakObjectPtr<UAsyncTaskThirdwebBootstrapSmartWallet> WeakThis = this;
+		FFunctionGraphTask::CreateAndDispatchWhenReady([WeakThis, Result]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->HandleResponse(Result);
+			}
+		}, TStatId(), nullptr, ENamedThreads::GameThread);
+		return;
+	}
+
+	Success.Broadcast(Result, TEXT(""));
+	SetReadyToDestroy();
+}
+
+void UAsyncTaskThirdwebBootstrapSmartWallet::HandleFailed(const FString& Error)
+{
+	if (!IsInGameThread())
+	{
+		TWeakObjectPtr<UAsyncTaskThirdwebBootstrapSmartWallet> WeakThis = this;
+		FFunctionGraphTask::CreateAndDispatchWhenReady([WeakThis, Error]()
+		{
+			if (WeakThis.IsValid())
+			{
+				WeakThis->HandleFailed(Error);
+			}
+		}, TStatId(), nullptr, ENamedThreads::GameThread);
+		return;
+	}
+
+	Failed.Broadcast(FThirdwebWalletBootstrapResult(), Error);
+	SetReadyToDestroy();
+}
@@ -0,0 +1,10 @@
+﻿// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "AsyncTasks/Wallets/InApp/Create/AsyncTaskThirdwebWarmStartWallet.h"
+
+#include "Wallets/ThirdwebInAppWalletHandle.h"
+
+void UAsyncTaskThirdwebWarmStartWallet::Activate()
+{
+	FInAppWalletHandle::WarmStart(BIND_CREATE_WALLET_SUCCESS_DELEGATE, {}, BIND_CREATE_WALLET_ERROR_DELEGATE);
+}
@@ -4,12 +4,10 @@
 
 #include "Async/TaskGraphInterfaces.h"
 #include "Components/SlateWrapperTypes.h"
-#include "Containers/ThirdwebSigner.h"
 
 void UAsyncTaskThirdwebIsActiveSigner::Activate()
 {
-	FString Error;
-	SmartWallet.IsDeployed(BIND_UOBJECT_DELEGATE(FBoolDelegate, HandleIsDeployedResponse), BIND_UOBJECT_DELEGATE(FStringDelegate, HandleFailed));
+	SmartWallet.IsActiveSigner(BackendWallet, BIND_UOBJECT_DELEGATE(FBoolDelegate, HandleResponse), BIND_UOBJECT_DELEGATE(FStringDelegate, HandleFailed));
 }
 
 UAsyncTaskThirdwebIsActiveSigner* UAsyncTaskThirdwebIsActiveSigner::IsActiveSigner(UObject* WorldContextObject, const FSmartWalletHandle& Wallet, const FString& BackendWallet)
@@ -25,37 +23,22 @@ UAsyncTaskThirdwebIsActiveSigner* UAsyncTaskThirdwebIsActiveSigner::IsActiveSign
 	return Task;
 }
 
-void UAsyncTaskThirdwebIsActiveSigner::HandleIsDeployedResponse(const bool bDeployed)
-{
-	if (bDeployed)
-	{
-		return SmartWallet.GetActiveSigners(BIND_UOBJECT_DELEGATE(FSmartWalletHandle::FGetActiveSignersDelegate, HandleResponse), BIND_UOBJECT_DELEGATE(FStringDelegate, HandleFailed));
-	}
-	HandleResponse({});
-}
-
-void UAsyncTaskThirdwebIsActiveSigner::HandleResponse(const TArray<FSigner>& Signers)
+void UAsyncTaskThirdwebIsActiveSigner::HandleResponse(const bool bActiveSigner)
 {
 	if (IsInGameThread())
 	{
-		for (int i = 0; i < Signers.Num(); i++)
-		{
-			if (Signers[i].Address.Equals(BackendWallet, ESearchCase::IgnoreCase))
-			{
-				Success.Broadcast(true, TEXT(""));
-				return SetReadyToDestroy();
-			}
-		}
+		Success.Broadcast(bActiveSigner, TEXT(""));
+		SetReadyToDestroy();
 	}
 	else
 	{
 		// Retry on the GameThread.
 		TWeakObjectPtr<UAsyncTaskThirdwebIsActiveSigner> WeakThis = this;
-		FFunctionGraphTask::CreateAndDispatchWhenReady([WeakThis, Signers]()
+		FFunctionGraphTask::CreateAndDispatchWhenReady([WeakThis, bActiveSigner]()
 		{
 			if (WeakThis.IsValid())
 			{
-				WeakThis->HandleResponse(Signers);
+				WeakThis->HandleResponse(bActiveSigner);
 			}
 		}, TStatId(), nullptr, ENamedThreads::GameThread);
 	}
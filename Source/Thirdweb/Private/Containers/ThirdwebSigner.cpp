@@ -3,6 +3,7 @@
 #include "Containers/ThirdwebSigner.h"
 
 #include "Dom/JsonObject.h"
+#include "Internal/ThirdwebJsonReader.h"
 
 FSigner FSigner::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -32,3 +33,44 @@ FSigner FSigner::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
 	}
 	return Signer;
 }
+
+FSigner FSigner::FromJson(FThirdwebJsonReader& Reader)
+{
+	FSigner Signer;
+	Reader.ReadObject([&Reader, &Signer](const FUtf8StringView Key)
+	{
+		if (Key == UTF8TEXT("signer"))
+		{
+			Reader.Read(Signer.Address);
+		}
+		else if (Key == UTF8TEXT("approvedTargets"))
+		{
+			Reader.ReadArray([&Reader, &Signer]()
+			{
+				if (FString Target; Reader.Read(Target))
+				{
+					Signer.ApprovedTargets.Emplace(MoveTemp(Target));
+				}
+			});
+		}
+		else if (Key == UTF8TEXT("nativeTokenLimitPerTransaction"))
+		{
+			Reader.Read(Signer.NativeTokenLimitPerTransaction);
+		}
+		else if (Key == UTF8TEXT("startTimestamp"))
+		{
+			if (FString Timestamp; Reader.Read(Timestamp))
+			{
+				Signer.StartTime = FDateTime::FromUnixTimestamp(FCString::Atoi(*Timestamp));
+			}
+		}
+		else if (Key == UTF8TEXT("endTimestamp"))
+		{
+			if (FString Timestamp; Reader.Read(Timestamp))
+			{
+				Signer.EndTime = FDateTime::FromUnixTimestamp(FCString::Atoi(*Timestamp));
+			}
+		}
+	});
+	return Signer;
+}
@@ -0,0 +1,265 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/BackendWallet/ThirdwebBackendWalletPool.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "Engine/GameInstance.h"
+#include "Engine/BackendWallet/ThirdwebBackendWallet.h"
+#include "Engine/BackendWallet/ThirdwebEngine_BackendWallet.h"
+#include "Engine/Contract/ThirdwebEngine_Contract.h"
+#include "Engine/Transaction/ThirdwebEngineTransactionOverrides.h"
+#include "Engine/Transaction/ThirdwebTransactionTracker.h"
+#include "Kismet/GameplayStatics.h"
+#include "Wallets/ThirdwebSmartWalletHandle.h"
+
+void UThirdwebBackendWalletPool::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Collection.InitializeDependency<UThirdwebTransactionTracker>();
+	Super::Initialize(Collection);
+	SetWallets(UThirdwebRuntimeSettings::GetEngineSigners());
+}
+
+void UThirdwebBackendWalletPool::SetWallets(const TArray<FString>& Addresses)
+{
+	TArray<FWallet> Previous = MoveTemp(Wallets);
+	Wallets.Reset(Addresses.Num());
+	for (const FString& Address : Addresses)
+	{
+		const FString Trimmed = Address.TrimStartAndEnd();
+		if (Trimmed.IsEmpty() || FindWallet(Trimmed) != INDEX_NONE)
+		{
+			continue;
+		}
+		const FWallet* Existing = Previous.FindByPredicate([&Trimmed](const FWallet& Wallet) { return Wallet.Address.Equals(Trimmed, ESearchCase::IgnoreCase); });
+		Wallets.Add({Trimmed, Existing ? Existing->Pending : 0});
+	}
+	for (auto It = Pins.CreateIterator(); It; ++It)
+	{
+		if (FindWallet(It.Value()) == INDEX_NONE)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	Cursor = 0;
+	TW_LOG(Verbose, TEXT("UThirdwebBackendWalletPool::SetWallets::Wallets=%d"), Wallets.Num())
+}
+
+void UThirdwebBackendWalletPool::SeedFromEngine(const FSimpleDelegate& CompleteDelegate, const FStringDelegate& ErrorDelegate)
+{
+	const TSharedRef<TArray<FString>> Addresses = MakeShared<TArray<FString>>();
+	ThirdwebEngine::BackendWallet::GetAllPaged(
+		this,
+		{},
+		ThirdwebEngine::BackendWallet::FGetAllDelegate::CreateWeakLambda(this, [Addresses](const TArray<FThirdwebBackendWallet>& BackendWallets)
+		{
+			for (const FThirdwebBackendWallet& BackendWallet : BackendWallets)
+			{
+				Addresses->Add(BackendWallet.Address);
+			}
+		}),
+		{},
+		FSimpleDelegate::CreateWeakLambda(this, [this, Addresses, CompleteDelegate]()
+		{
+			SetWallets(*Addresses);
+			EXECUTE_IF_BOUND(CompleteDelegate)
+		}),
+		ErrorDelegate
+	);
+}
+
+TArray<FString> UThirdwebBackendWalletPool::GetWallets() const
+{
+	TArray<FString> Addresses;
+	Addresses.Reserve(Wallets.Num());
+	for (const FWallet& Wallet : Wallets)
+	{
+		Addresses.Add(Wallet.Address);
+	}
+	return Addresses;
+}
+
+FString UThirdwebBackendWalletPool::Acquire(const FString& PinKey)
+{
+	if (Wallets.Num() == 0)
+	{
+		return TEXT("");
+	}
+	if (!PinKey.IsEmpty())
+	{
+		if (const FString* Pinned = Pins.Find(PinKey))
+		{
+			if (const int32 Index = FindWallet(*Pinned); Index != INDEX_NONE)
+			{
+				return Wallets[Index].Address;
+			}
+		}
+	}
+
+	int32 Picked = Cursor % Wallets.Num();
+	if (Strategy == EThirdwebBackendWalletPoolStrategy::LeastPending)
+	{
+		for (int32 i = 1; i < Wallets.Num(); i++)
+		{
+			const int32 Index = (Cursor + i) % Wallets.Num();
+			if (Wallets[Index].Pending < Wallets[Picked].Pending)
+			{
+				Picked = Index;
+			}
+		}
+	}
+	Cursor = (Picked + 1) % Wallets.Num();
+
+	if (!PinKey.IsEmpty())
+	{
+		if (Pins.Num() >= MaxIdlePins)
+		{
+			ExpireIdlePins();
+		}
+		Pins.Add(PinKey, Wallets[Picked].Address.ToLower());
+	}
+	return Wallets[Picked].Address;
+}
+
+void UThirdwebBackendWalletPool::Unpin(const FString& PinKey)
+{
+	Pins.Remove(PinKey);
+}
+
+void UThirdwebBackendWalletPool::Dispatch(const FString& PinKey, FSendFunction&& Send, const FStringDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
+{
+	const FString Address = Acquire(PinKey);
+	if (Address.IsEmpty())
+	{
+		EXECUTE_IF_BOUND(ErrorDelegate, TEXT("No backend wallets in pool"))
+		return;
+	}
+	Wallets[FindWallet(Address)].Pending++;
+
+	Send(
+		Address,
+		FStringDelegate::CreateWeakLambda(this, [this, Address, SuccessDelegate](const FString& QueueId)
+		{
+			if (UThirdwebTransactionTracker* Tracker = GetGameInstance()->GetSubsystem<UThirdwebTransactionTracker>(); Tracker && !QueueId.IsEmpty())
+			{
+				Tracker->Track(
+					QueueId,
+					UThirdwebTransactionTracker::FStatusDelegate::CreateUObject(this, &UThirdwebBackendWalletPool::OnStatus, Address),
+					FStringDelegate::CreateWeakLambda(this, [this, Address](const FString&) { Release(Address); })
+				);
+			}
+			else
+			{
+				Release(Address);
+			}
+			EXECUTE_IF_BOUND(SuccessDelegate, QueueId)
+		}),
+		FStringDelegate::CreateWeakLambda(this, [this, Address, ErrorDelegate](const FString& Error)
+		{
+			Release(Address);
+			EXECUTE_IF_BOUND(ErrorDelegate, Error)
+		})
+	);
+}
+
+void UThirdwebBackendWalletPool::Write(
+	const FString& PinKey,
+	const int64 ChainId,
+	const FString& ContractAddress,
+	const FSmartWalletHandle& SmartWallet,
+	const FString& FactoryAddress,
+	const FString& IdempotencyKey,
+	const FString& FunctionName,
+	const TArray<FString>& Args,
+	const FThirdwebEngineTransactionOverrides& TxOverrides,
+	const FString& Abi,
+	const FStringDelegate& SuccessDelegate,
+	const FStringDelegate& ErrorDelegate
+)
+{
+	Dispatch(
+		PinKey,
+		[this, ChainId, ContractAddress, SmartWallet, FactoryAddress, IdempotencyKey, FunctionName, Args, TxOverrides, Abi](const FString& BackendWalletAddress, const FStringDelegate& Success, const FStringDelegate& Error)
+		{
+			ThirdwebEngine::Contract::Write(
+				this,
+				ChainId,
+				ContractAddress,
+				BackendWalletAddress,
+				SmartWallet,
+				FactoryAddress,
+				IdempotencyKey,
+				FunctionName,
+				Args,
+				TxOverrides,
+				Abi,
+				false,
+				Success,
+				Error
+			);
+		},
+		SuccessDelegate,
+		ErrorDelegate
+	);
+}
+
+int32 UThirdwebBackendWalletPool::GetQueueDepth(const FString& BackendWalletAddress) const
+{
+	const int32 Index = FindWallet(BackendWalletAddress);
+	return Index == INDEX_NONE ? 0 : Wallets[Index].Pending;
+}
+
+TMap<FString, int32> UThirdwebBackendWalletPool::GetQueueDepths() const
+{
+	TMap<FString, int32> Depths;
+	for (const FWallet& Wallet : Wallets)
+	{
+		Depths.Add(Wallet.Address, Wallet.Pending);
+	}
+	return Depths;
+}
+
+UThirdwebBackendWalletPool* UThirdwebBackendWalletPool::Get(const UObject* WorldContextObject)
+{
+	if (UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject))
+	{
+		return GameInstance->GetSubsystem<UThirdwebBackendWalletPool>();
+	}
+	return nullptr;
+}
+
+int32 UThirdwebBackendWalletPool::FindWallet(const FString& Address) const
+{
+	return Wallets.IndexOfByPredicate([&Address](const FWallet& Wallet) { return Wallet.Address.Equals(Address, ESearchCase::IgnoreCase); });
+}
+
+void UThirdwebBackendWalletPool::Release(const FString& Address)
+{
+	if (const int32 Index = FindWallet(Address); Index != INDEX_NONE)
+	{
+		Wallets[Index].Pending = FMath::Max(0, Wallets[Index].Pending - 1);
+		if (Wallets[Index].Pending == 0)
+		{
+			ExpireIdlePins();
+		}
+	}
+}
+
+void UThirdwebBackendWalletPool::ExpireIdlePins()
+{
+	for (auto It = Pins.CreateIterator(); It; ++It)
+	{
+		if (const int32 Index = FindWallet(It.Value()); Index == INDEX_NONE || Wallets[Index].Pending == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UThirdwebBackendWalletPool::OnStatus(const FThirdwebEngineTransactionStatusResult& Result, FString Address)
+{
+	if (UThirdwebTransactionTracker::IsTerminal(Result.Status))
+	{
+		Release(Address);
+	}
+}
@@ -5,13 +5,16 @@
 #include "ThirdwebLog.h"
 #include "ThirdwebUtils.h"
 #include "Engine/ThirdwebEngine.h"
+#include "Engine/ThirdwebEngineClient.h"
 #include "Engine/BackendWallet/ThirdwebBackendWallet.h"
+#include "Engine/Transaction/ThirdwebEngineRawTransaction.h"
 #include "Engine/Transaction/ThirdwebEngineTransactionOverrides.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Internal/ThirdwebHeaders.h"
 #include "Internal/ThirdwebURLSearchParams.h"
 #include "Kismet/KismetStringLibrary.h"
+#include "UObject/Package.h"
 #include "Wallets/ThirdwebSmartWalletHandle.h"
 
 namespace ThirdwebEngine::BackendWallet
@@ -35,18 +38,86 @@ namespace ThirdwebEngine::BackendWallet
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::BackendWallet::GetAll::Content=%s"), *Content)
-			FString Error;
-			if (TArray<TSharedPtr<FJsonValue>> JsonArray; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonArray, Error))
-			{
-				EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebBackendWallet::FromJson(JsonArray))
-			}
-			else
+			ThirdwebEngine::ParseResponseAsync<TArray<TSharedPtr<FJsonValue>>>(
+				Response,
+				[](const TArray<TSharedPtr<FJsonValue>>& JsonArray) { return FThirdwebBackendWallet::FromJson(JsonArray); },
+				SuccessDelegate,
+				ErrorDelegate
+			);
+		});
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
+	}
+
+	TSharedRef<TThirdwebEnginePager<FThirdwebBackendWallet>> GetAllPaged(
+		const UObject* Outer,
+		const FThirdwebEnginePagerOptions& Options,
+		const FGetAllDelegate& PageDelegate,
+		const FThirdwebEnginePagerProgressDelegate& ProgressDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		TSharedRef<TThirdwebEnginePager<FThirdwebBackendWallet>> Pager = TThirdwebEnginePager<FThirdwebBackendWallet>::Create(
+			Outer,
+			[](const int32 PageIndex, const int32 PageSize, const FGetAllDelegate& Success, const FStringDelegate& Error)
 			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
-			}
+				// Engine pages are 1-based
+				GetAll(GetTransientPackage(), PageIndex + 1, PageSize, Success, Error);
+			},
+			nullptr,
+			Options,
+			PageDelegate,
+			ProgressDelegate,
+			CompleteDelegate,
+			ErrorDelegate
+		);
+		Pager->Start();
+		return Pager;
+	}
+
+	void SendTransactionBatch(
+		const UObject* Outer,
+		const int64 ChainId,
+		const FString& BackendWalletAddress,
+		const TArray<FThirdwebEngineRawTransaction>& Transactions,
+		const FString& IdempotencyKey,
+		const FStringArrayDelegate& SuccessDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const TSharedRef<IHttpRequest> Request = ThirdwebUtils::Internal::CreateEngineRequest(TEXT("POST"));
+		FThirdwebHeaders Headers;
+		Headers.Set(TEXT("x-backend-wallet-address"), BackendWalletAddress);
+		Headers.Set(TEXT("x-idempotency-key"), IdempotencyKey);
+		Headers.UpdateRequest(Request);
+
+		TArray<TSharedPtr<FJsonValue>> JsonTransactions;
+		for (const FThirdwebEngineRawTransaction& Transaction : Transactions)
+		{
+			JsonTransactions.Emplace(MakeShareable(new FJsonValueObject(Transaction.ToJson())));
+		}
+		Request->SetContentAsString(ThirdwebUtils::Json::ToString(JsonTransactions));
+
+		Request->SetURL(FormatUrl(FString::Printf(TEXT("%lld/send-transaction-batch"), ChainId), {}));
+		ThirdwebUtils::Internal::LogRequest(Request);
+		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
+		{
+			CHECK_NETWORK
+			ThirdwebEngine::ParseResponseAsync<TSharedPtr<FJsonObject>>(
+				Response,
+				[](const TSharedPtr<FJsonObject>& JsonObject)
+				{
+					TArray<FString> QueueIds;
+					if (JsonObject.IsValid() && JsonObject->HasTypedField<EJson::Array>(TEXT("queueIds")))
+					{
+						JsonObject->TryGetStringArrayField(TEXT("queueIds"), QueueIds);
+					}
+					return QueueIds;
+				},
+				SuccessDelegate,
+				ErrorDelegate
+			);
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 }
@@ -0,0 +1,47 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/Contract/ThirdwebEngineContractCall.h"
+
+#include "ThirdwebUtils.h"
+#include "Dom/JsonObject.h"
+
+TSharedPtr<FJsonObject> FThirdwebEngineContractCall::ToJson() const
+{
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetStringField(TEXT("contractAddress"), ContractAddress.TrimStartAndEnd());
+	JsonObject->SetStringField(TEXT("functionName"), FunctionName.TrimStartAndEnd());
+	TArray<TSharedPtr<FJsonValue>> JsonArgs;
+	for (const FString& Arg : Args)
+	{
+		JsonArgs.Emplace(MakeShareable(new FJsonValueString(Arg)));
+	}
+	JsonObject->SetArrayField(TEXT("args"), JsonArgs);
+	return JsonObject;
+}
+
+FThirdwebEngineContractCallResult FThirdwebEngineContractCallResult::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
+{
+	FThirdwebEngineContractCallResult Result;
+	if (!JsonObject.IsValid())
+	{
+		return MakeError(TEXT("Invalid call result"));
+	}
+	JsonObject->TryGetBoolField(TEXT("success"), Result.bSuccess);
+	const TSharedPtr<FJsonValue> Value = JsonObject->TryGetField(TEXT("result"));
+	if (Result.bSuccess)
+	{
+		Result.Result = Value.IsValid() ? ThirdwebUtils::Json::ToString(Value) : TEXT("");
+	}
+	else if (!JsonObject->TryGetStringField(TEXT("error"), Result.Error))
+	{
+		Result.Error = Value.IsValid() && Value->Type == EJson::String ? Value->AsString() : TEXT("Call reverted");
+	}
+	return Result;
+}
+
+FThirdwebEngineContractCallResult FThirdwebEngineContractCallResult::MakeError(const FString& Error)
+{
+	FThirdwebEngineContractCallResult Result;
+	Result.Error = Error;
+	return Result;
+}
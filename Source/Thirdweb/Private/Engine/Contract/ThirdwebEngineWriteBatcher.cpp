@@ -0,0 +1,146 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/Contract/ThirdwebEngineWriteBatcher.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "Engine/BackendWallet/ThirdwebEngine_BackendWallet.h"
+#include "Misc/Guid.h"
+#include "UObject/Package.h"
+
+FThirdwebEngineWriteBatcher& FThirdwebEngineWriteBatcher::Get()
+{
+	static FThirdwebEngineWriteBatcher Batcher;
+	return Batcher;
+}
+
+void FThirdwebEngineWriteBatcher::SendTransaction(
+	const UObject* Outer,
+	const int64 ChainId,
+	const FString& BackendWalletAddress,
+	const FThirdwebEngineRawTransaction& Transaction,
+	const FStringDelegate& SuccessDelegate,
+	const FStringDelegate& ErrorDelegate
+)
+{
+	const FString Key = MakeKey(ChainId, BackendWalletAddress);
+	const float Window = UThirdwebRuntimeSettings::GetEngineWriteBatchWindow();
+	bool bFull;
+	{
+		FScopeLock ScopeLock(&Lock);
+		FBatch* Batch = Batches.Find(Key);
+		if (!Batch)
+		{
+			Batch = &Batches.Add(Key, {ChainId, BackendWalletAddress});
+			if (Window > 0.0f)
+			{
+				Batch->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Key](float)
+				{
+					FlushBatch(Key);
+					return false;
+				}), Window);
+			}
+		}
+		Batch->Transactions.Add({Outer, Transaction, SuccessDelegate, ErrorDelegate});
+		bFull = Window <= 0.0f || Batch->Transactions.Num() >= UThirdwebRuntimeSettings::GetEngineWriteBatchMaxSize();
+	}
+	if (bFull)
+	{
+		FlushBatch(Key);
+	}
+}
+
+void FThirdwebEngineWriteBatcher::Flush()
+{
+	TArray<FString> Keys;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Batches.GetKeys(Keys);
+	}
+	for (const FString& Key : Keys)
+	{
+		FlushBatch(Key);
+	}
+}
+
+int32 FThirdwebEngineWriteBatcher::GetPendingCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	int32 Count = 0;
+	for (const TPair<FString, FBatch>& Pair : Batches)
+	{
+		Count += Pair.Value.Transactions.Num();
+	}
+	return Count;
+}
+
+FString FThirdwebEngineWriteBatcher::MakeKey(const int64 ChainId, const FString& BackendWalletAddress)
+{
+	return FString::Printf(TEXT("%lld/%s"), ChainId, *BackendWalletAddress.ToLower());
+}
+
+void FThirdwebEngineWriteBatcher::FlushBatch(const FString& Key)
+{
+	FBatch Batch;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!Batches.RemoveAndCopyValue(Key, Batch))
+		{
+			return;
+		}
+	}
+	// A batch submitted early must not leave its window behind to cut the next batch of the wallet short
+	if (Batch.TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(Batch.TickerHandle);
+	}
+	Submit(MoveTemp(Batch));
+}
+
+void FThirdwebEngineWriteBatcher::Submit(FBatch&& Batch)
+{
+	TW_LOG(Verbose, TEXT("FThirdwebEngineWriteBatcher::Submit::%lld/%s::Transactions=%d"), Batch.ChainId, *Batch.BackendWalletAddress, Batch.Transactions.Num())
+
+	TArray<FThirdwebEngineRawTransaction> Transactions;
+	Transactions.Reserve(Batch.Transactions.Num());
+	for (const FPendingTransaction& Pending : Batch.Transactions)
+	{
+		Transactions.Add(Pending.Transaction);
+	}
+	// The batch answers many callers, so it is bound to the transient package and every caller is checked on its own
+	ThirdwebEngine::BackendWallet::SendTransactionBatch(
+		GetTransientPackage(),
+		Batch.ChainId,
+		Batch.BackendWalletAddress,
+		Transactions,
+		FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower),
+		FStringArrayDelegate::CreateLambda([Pending = Batch.Transactions](const TArray<FString>& QueueIds)
+		{
+			for (int32 i = 0; i < Pending.Num(); i++)
+			{
+				if (Pending[i].Outer.IsStale())
+				{
+					continue;
+				}
+				if (QueueIds.IsValidIndex(i))
+				{
+					EXECUTE_IF_BOUND(Pending[i].SuccessDelegate, QueueIds[i])
+				}
+				else
+				{
+					EXECUTE_IF_BOUND(Pending[i].ErrorDelegate, TEXT("Missing queue ID in batch response"))
+				}
+			}
+		}),
+		FStringDelegate::CreateLambda([Pending = Batch.Transactions](const FString& Error)
+		{
+			for (const FPendingTransaction& Transaction : Pending)
+			{
+				if (!Transaction.Outer.IsStale())
+				{
+					EXECUTE_IF_BOUND(Transaction.ErrorDelegate, Error)
+				}
+			}
+		})
+	);
+}
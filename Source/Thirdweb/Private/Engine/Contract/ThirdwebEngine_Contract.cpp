@@ -5,12 +5,16 @@
 #include "ThirdwebLog.h"
 #include "ThirdwebUtils.h"
 #include "Engine/ThirdwebEngine.h"
+#include "Engine/ThirdwebEngineClient.h"
+#include "Engine/Contract/ThirdwebEngineContractCall.h"
 #include "Engine/Transaction/ThirdwebEngineTransactionOverrides.h"
+#include "Engine/Transaction/ThirdwebEngineWriteJournal.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Internal/ThirdwebHeaders.h"
 #include "Internal/ThirdwebURLSearchParams.h"
 #include "Kismet/KismetStringLibrary.h"
+#include "Misc/Guid.h"
 #include "Wallets/ThirdwebSmartWalletHandle.h"
 
 namespace ThirdwebEngine::Contract
@@ -40,19 +44,128 @@ namespace ThirdwebEngine::Contract
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Contract::Read::Content=%s"), *Content)
-			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			ThirdwebEngine::ParseResponseAsync<TSharedPtr<FJsonValue>>(
+				Response,
+				[](const TSharedPtr<FJsonValue>& JsonValue) { return ThirdwebUtils::Json::ToString(JsonValue); },
+				SuccessDelegate,
+				ErrorDelegate
+			);
+		});
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
+	}
+
+	/** Calls per read-batch request, keeping aggregated calls well below the gas limit of eth_call */
+	static constexpr int32 MaxReadBatchSize = 100;
+
+	void ReadBatch(
+		const UObject* Outer,
+		const TArray<FThirdwebEngineContractCall>& Calls,
+		const FReadBatchDelegate& SuccessDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		if (Calls.Num() == 0)
+		{
+			EXECUTE_IF_BOUND(ErrorDelegate, TEXT("No calls to read"))
+			return;
+		}
+
+		// Indices of the calls of every request, grouped by chain in order of first appearance
+		TArray<TPair<int64, TArray<int32>>> Groups;
+		TMap<int64, int32> OpenGroups;
+		for (int32 i = 0; i < Calls.Num(); i++)
+		{
+			const int32* GroupIndex = OpenGroups.Find(Calls[i].ChainId);
+			if (!GroupIndex || Groups[*GroupIndex].Value.Num() >= MaxReadBatchSize)
 			{
-				EXECUTE_IF_BOUND(SuccessDelegate, ThirdwebUtils::Json::ToString(JsonValue))
+				GroupIndex = &OpenGroups.Add(Calls[i].ChainId, Groups.Emplace(Calls[i].ChainId, TArray<int32>()));
 			}
-			else
+			Groups[*GroupIndex].Value.Add(i);
+		}
+
+		struct FState
+		{
+			TArray<FThirdwebEngineContractCallResult> Results;
+			int32 Remaining = 0;
+		};
+		const TSharedRef<FState> State = MakeShared<FState>();
+		State->Results.SetNum(Calls.Num());
+		State->Remaining = Groups.Num();
+		auto Complete = [State, SuccessDelegate]()
+		{
+			if (--State->Remaining == 0)
 			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
+				EXECUTE_IF_BOUND(SuccessDelegate, State->Results)
 			}
-		});
-		Request->ProcessRequest();
+		};
+
+		for (const TPair<int64, TArray<int32>>& Group : Groups)
+		{
+			const TSharedRef<IHttpRequest> Request = ThirdwebUtils::Internal::CreateEngineRequest(TEXT("POST"));
+			TArray<TSharedPtr<FJsonValue>> JsonCalls;
+			for (const int32 Index : Group.Value)
+			{
+				JsonCalls.Emplace(MakeShareable(new FJsonValueObject(Calls[Index].ToJson())));
+			}
+			const TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+			JsonObject->SetArrayField(TEXT("calls"), JsonCalls);
+			Request->SetContentAsString(ThirdwebUtils::Json::ToString(JsonObject));
+			Request->SetURL(ThirdwebEngine::FormatUrl(TEXT("contract"), FString::Printf(TEXT("%lld/read-batch"), Group.Key), {}));
+			ThirdwebUtils::Internal::LogRequest(Request);
+			Request->OnProcessRequestComplete().BindWeakLambda(Outer, [State, Indices = Group.Value, Complete](HTTP_LAMBDA_PARAMS)
+			{
+				auto Fail = [State, Indices, Complete](const FString& Error)
+				{
+					for (const int32 Index : Indices)
+					{
+						State->Results[Index] = FThirdwebEngineContractCallResult::MakeError(Error);
+					}
+					Complete();
+				};
+				if (!bConnectedSuccessfully)
+				{
+					Fail(TEXT("Network Connection Failed"));
+					return;
+				}
+				ThirdwebEngine::ParseResponseAsync<TSharedPtr<FJsonValue>>(
+					Response,
+					[Count = Indices.Num()](const TSharedPtr<FJsonValue>& JsonValue)
+					{
+						// Engine answers with the results array, either directly or wrapped in a `results` field
+						TArray<TSharedPtr<FJsonValue>> JsonResults;
+						if (JsonValue.IsValid() && JsonValue->Type == EJson::Array)
+						{
+							JsonResults = JsonValue->AsArray();
+						}
+						else if (JsonValue.IsValid() && JsonValue->Type == EJson::Object && JsonValue->AsObject()->HasTypedField<EJson::Array>(TEXT("results")))
+						{
+							JsonResults = JsonValue->AsObject()->GetArrayField(TEXT("results"));
+						}
+						TArray<FThirdwebEngineContractCallResult> Results;
+						Results.Reserve(Count);
+						for (int32 i = 0; i < Count; i++)
+						{
+							Results.Emplace(
+								JsonResults.IsValidIndex(i) && JsonResults[i]->Type == EJson::Object
+									? FThirdwebEngineContractCallResult::FromJson(JsonResults[i]->AsObject())
+									: FThirdwebEngineContractCallResult::MakeError(TEXT("Missing result in batch response"))
+							);
+						}
+						return Results;
+					},
+					FReadBatchDelegate::CreateLambda([State, Indices, Complete](const TArray<FThirdwebEngineContractCallResult>& Results)
+					{
+						for (int32 i = 0; i < Indices.Num(); i++)
+						{
+							State->Results[Indices[i]] = Results[i];
+						}
+						Complete();
+					}),
+					FStringDelegate::CreateLambda(Fail)
+				);
+			});
+			FThirdwebEngineClient::Get().ProcessRequest(Request);
+		}
 	}
 
 	void Write(
@@ -72,14 +185,19 @@ namespace ThirdwebEngine::Contract
 		const FStringDelegate& ErrorDelegate
 	)
 	{
+		// Journaled writes need a key to be replayed safely, so one is made up if the caller did not pass any
+		const bool bJournal = !bSimulateTx && FThirdwebEngineWriteJournal::IsEnabled();
+		const FString Key = bJournal && IdempotencyKey.IsEmpty() ? FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower) : IdempotencyKey;
+
 		const TSharedRef<IHttpRequest> Request = ThirdwebUtils::Internal::CreateEngineRequest(TEXT("POST"));
 		FThirdwebHeaders Headers;
 		Headers.Set(TEXT("x-backend-wallet-address"), BackendWalletAddress);
-		Headers.Set(TEXT("x-idempotency-key"), IdempotencyKey);
+		Headers.Set(TEXT("x-idempotency-key"), Key);
 		Headers.Set(TEXT("x-account-address"), SmartWallet.ToAddress(), SmartWallet.IsValid());
 		Headers.Set(TEXT("x-account-factory-address"), FactoryAddress);
 		Headers.UpdateRequest(Request);
 		
+		FString Content;
 		{
 			TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
 			JsonObject->SetStringField(TEXT("functionName"), FunctionName);
@@ -97,16 +215,30 @@ namespace ThirdwebEngine::Contract
 			{
 				JsonObject->SetArrayField(TEXT("abi"), ThirdwebUtils::Json::ToJsonArray(Abi));
 			}
-			Request->SetContentAsString(ThirdwebUtils::Json::ToString(JsonObject));
+			Content = ThirdwebUtils::Json::ToString(JsonObject);
 		}
+		Request->SetContentAsString(Content);
 
 		FThirdwebURLSearchParams Params;
 		Params.Set(TEXT("simulateTx"), true, bSimulateTx);
 		Request->SetURL(FormatUrl(ChainId, ContractAddress, TEXT("write"), Params));
 		ThirdwebUtils::Internal::LogRequest(Request);
-		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
+		if (bJournal)
 		{
-			CHECK_NETWORK
+			FThirdwebEngineWriteJournal::Get().Append(Key, Request->GetURL(), Headers.GetAll(), Content);
+		}
+		// Bound without Outer, so that the journal hears back even if the caller is gone
+		Request->OnProcessRequestComplete().BindLambda([WeakOuter = TWeakObjectPtr<const UObject>(Outer), bJournal, Key, SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
+		{
+			if (!bConnectedSuccessfully)
+			{
+				// The write may or may not have been queued, so it stays in the journal to be replayed
+				if (!WeakOuter.IsStale())
+				{
+					EXECUTE_IF_BOUND(ErrorDelegate, TEXT("Network Connection Failed"))
+				}
+				return;
+			}
 			FString Content = Response->GetContentAsString();
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Contract::Write::Content=%s"), *Content)
 			FString Error;
@@ -117,13 +249,28 @@ namespace ThirdwebEngine::Contract
 				{
 					QueueId = JsonObject->GetStringField(TEXT("queueId"));
 				}
-				EXECUTE_IF_BOUND(SuccessDelegate, QueueId)
+				if (bJournal)
+				{
+					FThirdwebEngineWriteJournal::Get().Acknowledge(Key, QueueId);
+				}
+				if (!WeakOuter.IsStale())
+				{
+					EXECUTE_IF_BOUND(SuccessDelegate, QueueId)
+				}
 			}
 			else
 			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
+				// Server errors and throttling left after retries may still have queued the write, so only a refusal is final
+				if (bJournal && FThirdwebEngineWriteJournal::IsRefused(Response))
+				{
+					FThirdwebEngineWriteJournal::Get().Reject(Key, Error);
+				}
+				if (!WeakOuter.IsStale())
+				{
+					EXECUTE_IF_BOUND(ErrorDelegate, Error)
+				}
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 }
@@ -4,13 +4,17 @@
 
 #include "ThirdwebLog.h"
 #include "ThirdwebUtils.h"
+#include "Engine/ThirdwebEngine.h"
+#include "Engine/ThirdwebEngineClient.h"
 #include "Engine/Marketplace/ThirdwebEngine_Marketplace.h"
 #include "Engine/Marketplace/DirectListings/ThirdwebMarketplaceDirectListing.h"
 #include "Engine/Marketplace/DirectListings/ThirdwebMarketplaceDirectListingRequest.h"
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Internal/ThirdwebHeaders.h"
+#include "Internal/ThirdwebJsonReader.h"
 #include "Internal/ThirdwebURLSearchParams.h"
+#include "UObject/Package.h"
 #include "Wallets/ThirdwebSmartWalletHandle.h"
 
 namespace ThirdwebEngine::Marketplace::DirectListings
@@ -20,8 +24,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 		return Marketplace::FormatUrl(ChainId, ContractAddress, TEXT("direct-listings"), Endpoint, Params);
 	}
 
-	void GetAll(
-		const UObject* Outer,
+	static TSharedRef<IHttpRequest> CreateGetAllRequest(
 		const int32 Count,
 		const FString& Seller,
 		const int32 Start,
@@ -29,9 +32,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 		const FString& TokenId,
 		const int64 Chain,
 		const FString& ContractAddress,
-		const bool bOnlyValid,
-		const FGetAllDelegate& SuccessDelegate,
-		const FStringDelegate& ErrorDelegate
+		const bool bOnlyValid
 	)
 	{
 		const TSharedRef<IHttpRequest> Request = ThirdwebUtils::Internal::CreateEngineRequest();
@@ -44,23 +45,106 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 		Params.Set(TEXT("tokenId"), TokenContract, TokenId.IsNumeric() && !TokenId.StartsWith("-"));
 
 		Request->SetURL(FormatUrl(Chain, ContractAddress, bOnlyValid ? TEXT("get-all-valid") : TEXT("get-all"), Params));
+		return Request;
+	}
+
+	void GetAll(
+		const UObject* Outer,
+		const int32 Count,
+		const FString& Seller,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const FGetAllDelegate& SuccessDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const TSharedRef<IHttpRequest> Request = CreateGetAllRequest(Count, Seller, Start, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid);
 		ThirdwebUtils::Internal::LogRequest(Request);
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::GetAll::Content=%s"), *Content)
-			FString Error;
-			if (TArray<TSharedPtr<FJsonValue>> JsonArray; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonArray, Error))
+			ThirdwebEngine::ReadResponseAsync(
+				Response,
+				[](FThirdwebJsonReader& Reader) { return Reader.ReadObjectArray<FThirdwebMarketplaceDirectListing>(); },
+				SuccessDelegate,
+				ErrorDelegate
+			);
+		});
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
+	}
+
+	void GetAllStreamed(
+		const UObject* Outer,
+		const int32 Count,
+		const FString& Seller,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const int32 BatchSize,
+		const FGetAllDelegate& BatchDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const TSharedRef<IHttpRequest> Request = CreateGetAllRequest(Count, Seller, Start, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid);
+		ThirdwebUtils::Internal::LogRequest(Request);
+		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [BatchSize, BatchDelegate, CompleteDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
+		{
+			CHECK_NETWORK
+			ThirdwebEngine::ReadResponseBatchesAsync<FThirdwebMarketplaceDirectListing>(Response, BatchSize, BatchDelegate, CompleteDelegate, ErrorDelegate);
+		});
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
+	}
+
+	TSharedRef<TThirdwebEnginePager<FThirdwebMarketplaceDirectListing>> GetAllPaged(
+		const UObject* Outer,
+		const FString& Seller,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const FThirdwebEnginePagerOptions& Options,
+		const FGetAllDelegate& PageDelegate,
+		const FThirdwebEnginePagerProgressDelegate& ProgressDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const int32 First = FMath::Max(0, Start);
+		TSharedRef<TThirdwebEnginePager<FThirdwebMarketplaceDirectListing>> Pager = TThirdwebEnginePager<FThirdwebMarketplaceDirectListing>::Create(
+			Outer,
+			[Seller, First, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid](const int32 PageIndex, const int32 PageSize, const FGetAllDelegate& Success, const FStringDelegate& Error)
 			{
-				EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebMarketplaceDirectListing::FromJson(JsonArray))
-			}
-			else
+				GetAll(GetTransientPackage(), PageSize, Seller, First + PageIndex * PageSize, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid, Success, Error);
+			},
+			[First, Chain, ContractAddress](const FInt32Delegate& Success, const FStringDelegate& Error)
 			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
-			}
-		});
-		Request->ProcessRequest();
+				// The total counts every listing ever created, so it bounds the index range left after Start
+				GetTotalCount(
+					GetTransientPackage(),
+					Chain,
+					ContractAddress,
+					FStringDelegate::CreateLambda([Success, First](const FString& Total) { EXECUTE_IF_BOUND(Success, FCString::Atoi(*Total) - First) }),
+					Error
+				);
+			},
+			Options,
+			PageDelegate,
+			ProgressDelegate,
+			CompleteDelegate,
+			ErrorDelegate
+		);
+		Pager->Start();
+		return Pager;
 	}
 
 	void Get(
@@ -83,19 +167,14 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::Get::Content=%s"), *Content)
-			FString Error;
-			if (TSharedPtr<FJsonObject> JsonObject; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonObject, Error))
-			{
-				EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebMarketplaceDirectListing::FromJson(JsonObject))
-			}
-			else
-			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
-			}
+			ThirdwebEngine::ReadResponseAsync(
+				Response,
+				[](FThirdwebJsonReader& Reader) { return FThirdwebMarketplaceDirectListing::FromJson(Reader); },
+				SuccessDelegate,
+				ErrorDelegate
+			);
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void IsBuyerApproved(
@@ -120,10 +199,8 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::IsBuyerApproved::Content=%s"), *Content)
 			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebEngine::ParseResponse(Response, JsonValue, Error))
 			{
 				EXECUTE_IF_BOUND(SuccessDelegate, JsonValue->AsBool())
 			}
@@ -132,7 +209,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 				EXECUTE_IF_BOUND(ErrorDelegate, Error)
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void IsCurrencyApproved(
@@ -157,10 +234,8 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::IsCurrencyApproved::Content=%s"), *Content)
 			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebEngine::ParseResponse(Response, JsonValue, Error))
 			{
 				EXECUTE_IF_BOUND(SuccessDelegate, JsonValue->AsBool())
 			}
@@ -169,7 +244,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 				EXECUTE_IF_BOUND(ErrorDelegate, Error)
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void GetTotalCount(const UObject* Outer, const int64 Chain, const FString& ContractAddress, const FStringDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
@@ -182,10 +257,8 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::GetTotalCount::Content=%s"), *Content)
 			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebEngine::ParseResponse(Response, JsonValue, Error))
 			{
 				EXECUTE_IF_BOUND(SuccessDelegate, JsonValue->AsString())
 			}
@@ -194,7 +267,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 				EXECUTE_IF_BOUND(ErrorDelegate, Error)
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Create(
@@ -228,7 +301,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::Create::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Update(
@@ -262,7 +335,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::Update::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Buy(
@@ -302,7 +375,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::Buy::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void ApproveReservedBuyer(
@@ -340,7 +413,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::ApproveReservedBuyer::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void RevokeReservedBuyerApproval(
@@ -378,7 +451,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::RevokeReservedBuyerApproval::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void RevokeReservedCurrencyApproval(
@@ -416,7 +489,7 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::RevokeReservedCurrencyApproval::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Cancel(
@@ -452,6 +525,6 @@ namespace ThirdwebEngine::Marketplace::DirectListings
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::DirectListings::Cancel::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 }
@@ -4,6 +4,7 @@
 
 #include "Dom/JsonObject.h"
 #include "Engine/Marketplace/ThirdwebMarketplaceCommon.h"
+#include "Internal/ThirdwebJsonReader.h"
 
 FThirdwebMarketplaceDirectListing FThirdwebMarketplaceDirectListing::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -12,6 +13,10 @@ FThirdwebMarketplaceDirectListing FThirdwebMarketplaceDirectListing::FromJson(co
 
 	if (JsonObject.IsValid())
 	{
+		if (JsonObject->HasTypedField<EJson::String>(TEXT("creatorAddress")))
+		{
+			Listing.CreatorAddress = JsonObject->GetStringField(TEXT("creatorAddress"));
+		}
 		if (JsonObject->HasTypedField<EJson::String>(TEXT("pricePerToken")))
 		{
 			Listing.PricePerToken = JsonObject->GetStringField(TEXT("pricePerToken"));
@@ -40,3 +45,32 @@ TArray<FThirdwebMarketplaceDirectListing> FThirdwebMarketplaceDirectListing::Fro
 	}
 	return Listings;
 }
+
+FThirdwebMarketplaceDirectListing FThirdwebMarketplaceDirectListing::FromJson(FThirdwebJsonReader& Reader)
+{
+	FThirdwebMarketplaceDirectListing Listing;
+	Reader.ReadObject([&Reader, &Listing](const FUtf8StringView Key)
+	{
+		if (Key == UTF8TEXT("creatorAddress"))
+		{
+			Reader.Read(Listing.CreatorAddress);
+		}
+		else if (Key == UTF8TEXT("pricePerToken"))
+		{
+			Reader.Read(Listing.PricePerToken);
+		}
+		else if (Key == UTF8TEXT("isReservedListing"))
+		{
+			Reader.Read(Listing.bIsReservedListing);
+		}
+		else if (Key == UTF8TEXT("currencyValuePerToken"))
+		{
+			Listing.CurrencyValuePerToken = FThirdwebAssetCurrencyValue::FromJson(Reader);
+		}
+		else
+		{
+			Listing.ReadField(Reader, Key);
+		}
+	});
+	return Listing;
+}
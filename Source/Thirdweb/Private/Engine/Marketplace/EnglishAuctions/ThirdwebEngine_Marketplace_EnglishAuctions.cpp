@@ -4,6 +4,8 @@
 
 #include "ThirdwebLog.h"
 #include "ThirdwebUtils.h"
+#include "Engine/ThirdwebEngine.h"
+#include "Engine/ThirdwebEngineClient.h"
 #include "Engine/Marketplace/ThirdwebEngine_Marketplace.h"
 #include "Engine/Marketplace/DirectListings/ThirdwebMarketplaceDirectListing.h"
 #include "Engine/Marketplace/EnglishAuctions/ThirdwebMarketplaceBid.h"
@@ -12,7 +14,9 @@
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Internal/ThirdwebHeaders.h"
+#include "Internal/ThirdwebJsonReader.h"
 #include "Internal/ThirdwebURLSearchParams.h"
+#include "UObject/Package.h"
 
 namespace ThirdwebEngine::Marketplace::EnglishAuctions
 {
@@ -21,8 +25,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		return Marketplace::FormatUrl(ChainId, ContractAddress, TEXT("english-auctions"), Endpoint, Params);
 	}
 
-	void GetAll(
-		const UObject* Outer,
+	static TSharedRef<IHttpRequest> CreateGetAllRequest(
 		const int32 Count,
 		const FString& Seller,
 		const int32 Start,
@@ -30,9 +33,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		const FString& TokenId,
 		const int64 Chain,
 		const FString& ContractAddress,
-		const bool bOnlyValid,
-		const FGetAllDelegate& SuccessDelegate,
-		const FStringDelegate& ErrorDelegate
+		const bool bOnlyValid
 	)
 	{
 		const TSharedRef<IHttpRequest> Request = ThirdwebUtils::Internal::CreateEngineRequest();
@@ -45,24 +46,106 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		Params.Set(TEXT("tokenId"), TokenContract, TokenId.IsNumeric() && !TokenId.StartsWith("-"));
 
 		Request->SetURL(FormatUrl(Chain, ContractAddress,  bOnlyValid ? TEXT("/get-all-valid") : TEXT("/get-all"), Params));
+		return Request;
+	}
 
+	void GetAll(
+		const UObject* Outer,
+		const int32 Count,
+		const FString& Seller,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const FGetAllDelegate& SuccessDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const TSharedRef<IHttpRequest> Request = CreateGetAllRequest(Count, Seller, Start, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid);
 		ThirdwebUtils::Internal::LogRequest(Request);
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::GetAll::Content=%s"), *Content)
-			FString Error;
-			if (TArray<TSharedPtr<FJsonValue>> JsonArray; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonArray, Error))
+			ThirdwebEngine::ReadResponseAsync(
+				Response,
+				[](FThirdwebJsonReader& Reader) { return Reader.ReadObjectArray<FThirdwebMarketplaceEnglishAuction>(); },
+				SuccessDelegate,
+				ErrorDelegate
+			);
+		});
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
+	}
+
+	void GetAllStreamed(
+		const UObject* Outer,
+		const int32 Count,
+		const FString& Seller,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const int32 BatchSize,
+		const FGetAllDelegate& BatchDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const TSharedRef<IHttpRequest> Request = CreateGetAllRequest(Count, Seller, Start, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid);
+		ThirdwebUtils::Internal::LogRequest(Request);
+		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [BatchSize, BatchDelegate, CompleteDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
+		{
+			CHECK_NETWORK
+			ThirdwebEngine::ReadResponseBatchesAsync<FThirdwebMarketplaceEnglishAuction>(Response, BatchSize, BatchDelegate, CompleteDelegate, ErrorDelegate);
+		});
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
+	}
+
+	TSharedRef<TThirdwebEnginePager<FThirdwebMarketplaceEnglishAuction>> GetAllPaged(
+		const UObject* Outer,
+		const FString& Seller,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const FThirdwebEnginePagerOptions& Options,
+		const FGetAllDelegate& PageDelegate,
+		const FThirdwebEnginePagerProgressDelegate& ProgressDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const int32 First = FMath::Max(0, Start);
+		TSharedRef<TThirdwebEnginePager<FThirdwebMarketplaceEnglishAuction>> Pager = TThirdwebEnginePager<FThirdwebMarketplaceEnglishAuction>::Create(
+			Outer,
+			[Seller, First, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid](const int32 PageIndex, const int32 PageSize, const FGetAllDelegate& Success, const FStringDelegate& Error)
 			{
-				EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebMarketplaceEnglishAuction::FromJson(JsonArray))
-			}
-			else
+				GetAll(GetTransientPackage(), PageSize, Seller, First + PageIndex * PageSize, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid, Success, Error);
+			},
+			[First, Chain, ContractAddress](const FInt32Delegate& Success, const FStringDelegate& Error)
 			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
-			}
-		});
-		Request->ProcessRequest();
+				// The total counts every auction ever created, so it bounds the index range left after Start
+				GetTotalCount(
+					GetTransientPackage(),
+					Chain,
+					ContractAddress,
+					FStringDelegate::CreateLambda([Success, First](const FString& Total) { EXECUTE_IF_BOUND(Success, FCString::Atoi(*Total) - First) }),
+					Error
+				);
+			},
+			Options,
+			PageDelegate,
+			ProgressDelegate,
+			CompleteDelegate,
+			ErrorDelegate
+		);
+		Pager->Start();
+		return Pager;
 	}
 
 	void Get(
@@ -85,19 +168,14 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::GetAuction::Content=%s"), *Content)
-			FString Error;
-			if (TSharedPtr<FJsonObject> JsonObject; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonObject, Error))
-			{
-				EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebMarketplaceEnglishAuction::FromJson(JsonObject))
-			}
-			else
-			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
-			}
+			ThirdwebEngine::ReadResponseAsync(
+				Response,
+				[](FThirdwebJsonReader& Reader) { return FThirdwebMarketplaceEnglishAuction::FromJson(Reader); },
+				SuccessDelegate,
+				ErrorDelegate
+			);
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void GetBidBufferBps(
@@ -120,10 +198,8 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::GetBidBufferBps::Content=%s"), *Content)
 			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebEngine::ParseResponse(Response, JsonValue, Error))
 			{
 				EXECUTE_IF_BOUND(SuccessDelegate, JsonValue->AsNumber())
 			}
@@ -132,7 +208,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 				EXECUTE_IF_BOUND(ErrorDelegate, Error)
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void GetMinimumNextBid(
@@ -155,10 +231,8 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::GetMinimumNextBid::Content=%s"), *Content)
 			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebEngine::ParseResponse(Response, JsonValue, Error))
 			{
 				EXECUTE_IF_BOUND(SuccessDelegate, JsonValue->AsString())
 			}
@@ -167,7 +241,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 				EXECUTE_IF_BOUND(ErrorDelegate, Error)
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void GetWinningBid(
@@ -190,19 +264,14 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::GetWinningBid::Content=%s"), *Content)
-			FString Error;
-			if (TSharedPtr<FJsonObject> JsonObject; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonObject, Error))
-			{
-				EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebMarketplaceBid::FromJson(JsonObject))
-			}
-			else
-			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
-			}
+			ThirdwebEngine::ParseResponseAsync<TSharedPtr<FJsonObject>>(
+				Response,
+				[](const TSharedPtr<FJsonObject>& JsonObject) { return FThirdwebMarketplaceBid::FromJson(JsonObject); },
+				SuccessDelegate,
+				ErrorDelegate
+			);
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void GetTotalCount(const UObject* Outer, const int64 Chain, const FString& ContractAddress, const FStringDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
@@ -215,10 +284,8 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::GetTotalCount::Content=%s"), *Content)
 			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebEngine::ParseResponse(Response, JsonValue, Error))
 			{
 				EXECUTE_IF_BOUND(SuccessDelegate, JsonValue->AsString())
 			}
@@ -227,7 +294,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 				EXECUTE_IF_BOUND(ErrorDelegate, Error)
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void IsWinningBid(
@@ -252,10 +319,8 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::IsWinningBid::Content=%s"), *Content)
 			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebEngine::ParseResponse(Response, JsonValue, Error))
 			{
 				EXECUTE_IF_BOUND(SuccessDelegate, JsonValue->AsBool())
 			}
@@ -264,7 +329,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 				EXECUTE_IF_BOUND(ErrorDelegate, Error)
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void GetWinner(
@@ -287,10 +352,8 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::GetWinner::Content=%s"), *Content)
 			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebEngine::ParseResponse(Response, JsonValue, Error))
 			{
 				EXECUTE_IF_BOUND(SuccessDelegate, JsonValue->AsString())
 			}
@@ -299,7 +362,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 				EXECUTE_IF_BOUND(ErrorDelegate, Error)
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Buyout(
@@ -335,7 +398,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::BuyoutAuction::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Cancel(
@@ -371,7 +434,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::Cancel::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Create(
@@ -405,7 +468,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::Cancel::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void CloseForBidder(
@@ -441,7 +504,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::CloseForBidder::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void CloseForSeller(
@@ -477,7 +540,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::CloseForSeller::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void ExecuteSale(
@@ -513,7 +576,7 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::ExecuteSale::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Bid(
@@ -551,6 +614,6 @@ namespace ThirdwebEngine::Marketplace::EnglishAuctions
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::EnglishAuctions::Bid::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 }
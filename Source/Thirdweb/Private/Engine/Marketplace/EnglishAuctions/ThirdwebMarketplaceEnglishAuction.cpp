@@ -4,6 +4,7 @@
 
 #include "Dom/JsonObject.h"
 #include "Engine/Marketplace/ThirdwebMarketplaceCommon.h"
+#include "Internal/ThirdwebJsonReader.h"
 
 FThirdwebMarketplaceEnglishAuction FThirdwebMarketplaceEnglishAuction::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -12,6 +13,10 @@ FThirdwebMarketplaceEnglishAuction FThirdwebMarketplaceEnglishAuction::FromJson(
 	
 	if (JsonObject.IsValid())
 	{
+		if (JsonObject->HasTypedField<EJson::String>(TEXT("creatorAddress")))
+		{
+			Auction.CreatorAddress = JsonObject->GetStringField(TEXT("creatorAddress"));
+		}
 		if (JsonObject->HasTypedField<EJson::String>(TEXT("minimumBidAmount")))
 		{
 			Auction.MinimumBidAmount = JsonObject->GetStringField(TEXT("minimumBidAmount"));
@@ -48,3 +53,43 @@ TArray<FThirdwebMarketplaceEnglishAuction> FThirdwebMarketplaceEnglishAuction::F
 	}
 	return Auctions;
 }
+
+FThirdwebMarketplaceEnglishAuction FThirdwebMarketplaceEnglishAuction::FromJson(FThirdwebJsonReader& Reader)
+{
+	FThirdwebMarketplaceEnglishAuction Auction;
+	Reader.ReadObject([&Reader, &Auction](const FUtf8StringView Key)
+	{
+		if (Key == UTF8TEXT("creatorAddress"))
+		{
+			Reader.Read(Auction.CreatorAddress);
+		}
+		else if (Key == UTF8TEXT("minimumBidAmount"))
+		{
+			Reader.Read(Auction.MinimumBidAmount);
+		}
+		else if (Key == UTF8TEXT("buyoutBidAmount"))
+		{
+			Reader.Read(Auction.BuyoutBidAmount);
+		}
+		else if (Key == UTF8TEXT("buyoutCurrencyValue"))
+		{
+			Auction.BuyoutCurrencyValue = FThirdwebAssetCurrencyValue::FromJson(Reader);
+		}
+		else if (Key == UTF8TEXT("timeBufferInSeconds"))
+		{
+			if (int64 Value; Reader.Read(Value))
+			{
+				Auction.TimeBufferInSeconds = FDateTime::FromUnixTimestamp(Value);
+			}
+		}
+		else if (Key == UTF8TEXT("bidBufferBps"))
+		{
+			Reader.Read(Auction.BidBufferBps);
+		}
+		else
+		{
+			Auction.ReadField(Reader, Key);
+		}
+	});
+	return Auction;
+}
@@ -5,6 +5,8 @@
 #include "ThirdwebLog.h"
 #include "ThirdwebUtils.h"
 #include "Engine/ThirdwebAccountIdentifierParams.h"
+#include "Engine/ThirdwebEngine.h"
+#include "Engine/ThirdwebEngineClient.h"
 #include "Engine/Marketplace/ThirdwebEngine_Marketplace.h"
 #include "Engine/Marketplace/DirectListings/ThirdwebMarketplaceDirectListing.h"
 #include "Engine/Marketplace/Offers/ThirdwebMarketplaceMakeOfferRequest.h"
@@ -12,7 +14,9 @@
 #include "Interfaces/IHttpRequest.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Internal/ThirdwebHeaders.h"
+#include "Internal/ThirdwebJsonReader.h"
 #include "Internal/ThirdwebURLSearchParams.h"
+#include "UObject/Package.h"
 
 namespace ThirdwebEngine::Marketplace::Offers
 {
@@ -21,8 +25,7 @@ namespace ThirdwebEngine::Marketplace::Offers
 		return Marketplace::FormatUrl(ChainId, ContractAddress, TEXT("offers"), Endpoint, Params);
 	}
 
-	void GetAll(
-		const UObject* Outer,
+	static TSharedRef<IHttpRequest> CreateGetAllRequest(
 		const int32 Count,
 		const FString& Offeror,
 		const int32 Start,
@@ -30,9 +33,7 @@ namespace ThirdwebEngine::Marketplace::Offers
 		const FString& TokenId,
 		const int64 Chain,
 		const FString& ContractAddress,
-		const bool bOnlyValid,
-		const FGetAllDelegate& SuccessDelegate,
-		const FStringDelegate& ErrorDelegate
+		const bool bOnlyValid
 	)
 	{
 		const TSharedRef<IHttpRequest> Request = ThirdwebUtils::Internal::CreateEngineRequest();
@@ -45,24 +46,106 @@ namespace ThirdwebEngine::Marketplace::Offers
 		Params.Set(TEXT("tokenId"), TokenContract, TokenId.IsNumeric() && !TokenId.StartsWith("-"));
 
 		Request->SetURL(FormatUrl(Chain, ContractAddress, bOnlyValid ? TEXT("/get-all-valid") : TEXT("/get-all"), Params));
+		return Request;
+	}
 
+	void GetAll(
+		const UObject* Outer,
+		const int32 Count,
+		const FString& Offeror,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const FGetAllDelegate& SuccessDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const TSharedRef<IHttpRequest> Request = CreateGetAllRequest(Count, Offeror, Start, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid);
 		ThirdwebUtils::Internal::LogRequest(Request);
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::Offers::GetAll::Content=%s"), *Content)
-			FString Error;
-			if (TArray<TSharedPtr<FJsonValue>> JsonArray; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonArray, Error))
+			ThirdwebEngine::ReadResponseAsync(
+				Response,
+				[](FThirdwebJsonReader& Reader) { return Reader.ReadObjectArray<FThirdwebMarketplaceOffer>(); },
+				SuccessDelegate,
+				ErrorDelegate
+			);
+		});
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
+	}
+
+	void GetAllStreamed(
+		const UObject* Outer,
+		const int32 Count,
+		const FString& Offeror,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const int32 BatchSize,
+		const FGetAllDelegate& BatchDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const TSharedRef<IHttpRequest> Request = CreateGetAllRequest(Count, Offeror, Start, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid);
+		ThirdwebUtils::Internal::LogRequest(Request);
+		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [BatchSize, BatchDelegate, CompleteDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
+		{
+			CHECK_NETWORK
+			ThirdwebEngine::ReadResponseBatchesAsync<FThirdwebMarketplaceOffer>(Response, BatchSize, BatchDelegate, CompleteDelegate, ErrorDelegate);
+		});
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
+	}
+
+	TSharedRef<TThirdwebEnginePager<FThirdwebMarketplaceOffer>> GetAllPaged(
+		const UObject* Outer,
+		const FString& Offeror,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const FThirdwebEnginePagerOptions& Options,
+		const FGetAllDelegate& PageDelegate,
+		const FThirdwebEnginePagerProgressDelegate& ProgressDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	)
+	{
+		const int32 First = FMath::Max(0, Start);
+		TSharedRef<TThirdwebEnginePager<FThirdwebMarketplaceOffer>> Pager = TThirdwebEnginePager<FThirdwebMarketplaceOffer>::Create(
+			Outer,
+			[Offeror, First, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid](const int32 PageIndex, const int32 PageSize, const FGetAllDelegate& Success, const FStringDelegate& Error)
 			{
-				EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebMarketplaceOffer::FromJson(JsonArray))
-			}
-			else
+				GetAll(GetTransientPackage(), PageSize, Offeror, First + PageIndex * PageSize, TokenContract, TokenId, Chain, ContractAddress, bOnlyValid, Success, Error);
+			},
+			[First, Chain, ContractAddress](const FInt32Delegate& Success, const FStringDelegate& Error)
 			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
-			}
-		});
-		Request->ProcessRequest();
+				// The total counts every offer ever created, so it bounds the index range left after Start
+				GetTotalCount(
+					GetTransientPackage(),
+					Chain,
+					ContractAddress,
+					FStringDelegate::CreateLambda([Success, First](const FString& Total) { EXECUTE_IF_BOUND(Success, FCString::Atoi(*Total) - First) }),
+					Error
+				);
+			},
+			Options,
+			PageDelegate,
+			ProgressDelegate,
+			CompleteDelegate,
+			ErrorDelegate
+		);
+		Pager->Start();
+		return Pager;
 	}
 
 	void Get(const UObject* Outer, const FString& OfferId, const int64 Chain, const FString& ContractAddress, const FGetOfferDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
@@ -78,19 +161,14 @@ namespace ThirdwebEngine::Marketplace::Offers
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::Offers::Get::Content=%s"), *Content)
-			FString Error;
-			if (TSharedPtr<FJsonObject> JsonObject; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonObject, Error))
-			{
-				EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebMarketplaceOffer::FromJson(JsonObject))
-			}
-			else
-			{
-				EXECUTE_IF_BOUND(ErrorDelegate, Error)
-			}
+			ThirdwebEngine::ReadResponseAsync(
+				Response,
+				[](FThirdwebJsonReader& Reader) { return FThirdwebMarketplaceOffer::FromJson(Reader); },
+				SuccessDelegate,
+				ErrorDelegate
+			);
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void GetTotalCount(
@@ -109,10 +187,8 @@ namespace ThirdwebEngine::Marketplace::Offers
 		Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 		{
 			CHECK_NETWORK
-			FString Content = Response->GetContentAsString();
-			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::Offers::GetTotalCount::Content=%s"), *Content)
 			FString Error;
-			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error))
+			if (TSharedPtr<FJsonValue> JsonValue; ThirdwebEngine::ParseResponse(Response, JsonValue, Error))
 			{
 				EXECUTE_IF_BOUND(SuccessDelegate, JsonValue->AsString())
 			}
@@ -121,7 +197,7 @@ namespace ThirdwebEngine::Marketplace::Offers
 				EXECUTE_IF_BOUND(ErrorDelegate, Error)
 			}
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Offer(
@@ -155,7 +231,7 @@ namespace ThirdwebEngine::Marketplace::Offers
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::Offers::Offer::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Cancel(
@@ -191,7 +267,7 @@ namespace ThirdwebEngine::Marketplace::Offers
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::Offers::Cancel::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 
 	void Accept(
@@ -226,6 +302,6 @@ namespace ThirdwebEngine::Marketplace::Offers
 			TW_LOG(Verbose, TEXT("ThirdwebEngine::Marketplace::Offers::Accept::Content=%s"), *Content)
 			HANDLE_QUEUE_ID_RESPONSE
 		});
-		Request->ProcessRequest();
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
 	}
 }
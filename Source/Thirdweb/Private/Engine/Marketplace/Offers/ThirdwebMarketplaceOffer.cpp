@@ -4,6 +4,7 @@
 
 #include "Dom/JsonObject.h"
 #include "Engine/Marketplace/ThirdwebMarketplaceCommon.h"
+#include "Internal/ThirdwebJsonReader.h"
 #include "Misc/DateTime.h"
 
 FThirdwebMarketplaceOffer FThirdwebMarketplaceOffer::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
@@ -40,3 +41,28 @@ TArray<FThirdwebMarketplaceOffer> FThirdwebMarketplaceOffer::FromJson(const TArr
 	}
 	return Offers;
 }
+
+FThirdwebMarketplaceOffer FThirdwebMarketplaceOffer::FromJson(FThirdwebJsonReader& Reader)
+{
+	FThirdwebMarketplaceOffer Offer;
+	Reader.ReadObject([&Reader, &Offer](const FUtf8StringView Key)
+	{
+		if (Key == UTF8TEXT("offerorAddress"))
+		{
+			Reader.Read(Offer.OfferorAddress);
+		}
+		else if (Key == UTF8TEXT("currencyValue"))
+		{
+			Offer.CurrencyValue = FThirdwebAssetCurrencyValue::FromJson(Reader);
+		}
+		else if (Key == UTF8TEXT("totalPrice"))
+		{
+			Reader.Read(Offer.TotalPrice);
+		}
+		else
+		{
+			Offer.ReadField(Reader, Key);
+		}
+	});
+	return Offer;
+}
@@ -0,0 +1,175 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/Marketplace/ThirdwebMarketplaceIndex.h"
+
+#include "ThirdwebLog.h"
+#include "Engine/Marketplace/ThirdwebEngine_Marketplace.h"
+
+namespace ThirdwebMarketplaceIndex
+{
+	bool IsAmountLess(const FString& A, const FString& B)
+	{
+		auto Digits = [](const FString& Value)
+		{
+			int32 Start = 0;
+			while (Start < Value.Len() - 1 && Value[Start] == TEXT('0'))
+			{
+				Start++;
+			}
+			return FStringView(Value).RightChop(Start);
+		};
+		const FStringView DigitsA = Digits(A);
+		const FStringView DigitsB = Digits(B);
+		if (DigitsA.Len() != DigitsB.Len())
+		{
+			return DigitsA.Len() < DigitsB.Len();
+		}
+		return DigitsA.Compare(DigitsB) < 0;
+	}
+}
+
+FThirdwebMarketplaceIndex::FThirdwebMarketplaceIndex(const int64 InChainId, const FString& InContractAddress)
+	: ChainId(InChainId), ContractAddress(InContractAddress)
+{
+}
+
+void FThirdwebMarketplaceIndex::Refresh(const UObject* Outer, const bool bFull, const FSimpleDelegate& CompleteDelegate, const FStringDelegate& ErrorDelegate)
+{
+	if (PendingSections > 0 && bFull && !bRefreshingFull)
+	{
+		QueuedFullOuter = Outer;
+		QueuedFullCompleteDelegates.Add(CompleteDelegate);
+		QueuedFullErrorDelegates.Add(ErrorDelegate);
+		return;
+	}
+	CompleteDelegates.Add(CompleteDelegate);
+	ErrorDelegates.Add(ErrorDelegate);
+	if (PendingSections > 0)
+	{
+		return;
+	}
+	bRefreshingFull = bFull;
+	if (bFull)
+	{
+		LoadedListings = LoadedAuctions = LoadedOffers = 0;
+	}
+	TW_LOG(Verbose, TEXT("FThirdwebMarketplaceIndex::Refresh::%lld/%s::Listings=%d::Auctions=%d::Offers=%d"), ChainId, *ContractAddress, LoadedListings, LoadedAuctions, LoadedOffers)
+
+	using namespace ThirdwebEngine::Marketplace;
+	PendingSections = 3;
+	RefreshError.Empty();
+	const FThirdwebEnginePagerOptions Options;
+	DirectListings::GetAllPaged(
+		Outer,
+		TEXT(""),
+		LoadedListings,
+		TEXT(""),
+		TEXT(""),
+		ChainId,
+		ContractAddress,
+		false,
+		Options,
+		DirectListings::FGetAllDelegate::CreateSP(AsShared(), &FThirdwebMarketplaceIndex::OnListings),
+		{},
+		FSimpleDelegate::CreateSP(AsShared(), &FThirdwebMarketplaceIndex::OnSectionComplete),
+		FStringDelegate::CreateSP(AsShared(), &FThirdwebMarketplaceIndex::OnSectionError)
+	);
+	EnglishAuctions::GetAllPaged(
+		Outer,
+		TEXT(""),
+		LoadedAuctions,
+		TEXT(""),
+		TEXT(""),
+		ChainId,
+		ContractAddress,
+		false,
+		Options,
+		EnglishAuctions::FGetAllDelegate::CreateSP(AsShared(), &FThirdwebMarketplaceIndex::OnAuctions),
+		{},
+		FSimpleDelegate::CreateSP(AsShared(), &FThirdwebMarketplaceIndex::OnSectionComplete),
+		FStringDelegate::CreateSP(AsShared(), &FThirdwebMarketplaceIndex::OnSectionError)
+	);
+	Offers::GetAllPaged(
+		Outer,
+		TEXT(""),
+		LoadedOffers,
+		TEXT(""),
+		TEXT(""),
+		ChainId,
+		ContractAddress,
+		false,
+		Options,
+		Offers::FGetAllDelegate::CreateSP(AsShared(), &FThirdwebMarketplaceIndex::OnOffers),
+		{},
+		FSimpleDelegate::CreateSP(AsShared(), &FThirdwebMarketplaceIndex::OnSectionComplete),
+		FStringDelegate::CreateSP(AsShared(), &FThirdwebMarketplaceIndex::OnSectionError)
+	);
+}
+
+void FThirdwebMarketplaceIndex::OnListings(const TArray<FThirdwebMarketplaceDirectListing>& Page)
+{
+	Listings.Upsert(Page);
+	Advance(Page, LoadedListings);
+}
+
+void FThirdwebMarketplaceIndex::OnAuctions(const TArray<FThirdwebMarketplaceEnglishAuction>& Page)
+{
+	Auctions.Upsert(Page);
+	Advance(Page, LoadedAuctions);
+}
+
+void FThirdwebMarketplaceIndex::OnOffers(const TArray<FThirdwebMarketplaceOffer>& Page)
+{
+	Offers.Upsert(Page);
+	Advance(Page, LoadedOffers);
+}
+
+void FThirdwebMarketplaceIndex::OnSectionComplete()
+{
+	if (--PendingSections > 0)
+	{
+		return;
+	}
+	const TArray<FSimpleDelegate> Completed = MoveTemp(CompleteDelegates);
+	const TArray<FStringDelegate> Failed = MoveTemp(ErrorDelegates);
+	CompleteDelegates.Reset();
+	ErrorDelegates.Reset();
+	if (RefreshError.IsEmpty())
+	{
+		for (const FSimpleDelegate& Delegate : Completed)
+		{
+			EXECUTE_IF_BOUND(Delegate)
+		}
+	}
+	else
+	{
+		for (const FStringDelegate& Delegate : Failed)
+		{
+			EXECUTE_IF_BOUND(Delegate, RefreshError)
+		}
+	}
+
+	if (QueuedFullCompleteDelegates.Num() > 0)
+	{
+		const TArray<FSimpleDelegate> QueuedCompleted = MoveTemp(QueuedFullCompleteDelegates);
+		const TArray<FStringDelegate> QueuedFailed = MoveTemp(QueuedFullErrorDelegates);
+		QueuedFullCompleteDelegates.Reset();
+		QueuedFullErrorDelegates.Reset();
+		// The first call starts the full refresh and the others join it
+		for (int32 i = 0; i < QueuedCompleted.Num(); i++)
+		{
+			Refresh(QueuedFullOuter.Get(), true, QueuedCompleted[i], QueuedFailed[i]);
+		}
+	}
+}
+
+void FThirdwebMarketplaceIndex::OnSectionError(const FString& Error)
+{
+	TW_LOG(Warning, TEXT("FThirdwebMarketplaceIndex::OnSectionError::%lld/%s::%s"), ChainId, *ContractAddress, *Error)
+	if (RefreshError.IsEmpty())
+	{
+		RefreshError = Error;
+	}
+	// Entries received before the error stay indexed, and the next refresh resumes after them
+	OnSectionComplete();
+}
@@ -4,6 +4,7 @@
 
 #include "Dom/JsonObject.h"
 #include "Engine/Marketplace/ThirdwebMarketplaceCommon.h"
+#include "Internal/ThirdwebJsonReader.h"
 
 void FThirdwebMarketplaceInternalEntryBase::Load(const FThirdwebMarketplaceInternalEntryBase& Base)
 {
@@ -18,6 +19,62 @@ void FThirdwebMarketplaceInternalEntryBase::Load(const FThirdwebMarketplaceInter
 	EndTimeInSeconds = Base.EndTimeInSeconds;
 }
 
+bool FThirdwebMarketplaceInternalEntryBase::ReadField(FThirdwebJsonReader& Reader, const FUtf8StringView Key)
+{
+	if (Key == UTF8TEXT("assetContractAddress"))
+	{
+		Reader.Read(AssetContractAddress);
+	}
+	else if (Key == UTF8TEXT("tokenId"))
+	{
+		Reader.Read(TokenId);
+	}
+	else if (Key == UTF8TEXT("currencyContractAddress"))
+	{
+		Reader.Read(CurrencyContractAddress);
+	}
+	else if (Key == UTF8TEXT("quantity"))
+	{
+		Reader.Read(Quantity);
+	}
+	else if (Key == UTF8TEXT("id"))
+	{
+		Reader.Read(Id);
+	}
+	else if (Key == UTF8TEXT("asset"))
+	{
+		Asset = FThirdwebAsset::FromJson(Reader);
+	}
+	else if (Key == UTF8TEXT("status"))
+	{
+		if (int32 Value; Reader.Read(Value))
+		{
+			Status = Value >= 0 && Value <= static_cast<int32>(EThirdwebMarketplaceListingStatus::Max)
+				         ? static_cast<EThirdwebMarketplaceListingStatus>(Value)
+				         : EThirdwebMarketplaceListingStatus::Invalid;
+		}
+	}
+	else if (Key == UTF8TEXT("startTimeInSeconds"))
+	{
+		if (int64 Value; Reader.Read(Value))
+		{
+			StartTimeInSeconds = FDateTime::FromUnixTimestamp(Value);
+		}
+	}
+	else if (Key == UTF8TEXT("endTimeInSeconds"))
+	{
+		if (int64 Value; Reader.Read(Value))
+		{
+			EndTimeInSeconds = FDateTime::FromUnixTimestamp(Value);
+		}
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
 FThirdwebMarketplaceInternalEntryBase FThirdwebMarketplaceInternalEntryBase::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	FThirdwebMarketplaceInternalEntryBase Base = {};
@@ -13,6 +13,7 @@ void UThirdwebMarketplaceSubsystem::Initialize(FSubsystemCollectionBase& Collect
 
 void UThirdwebMarketplaceSubsystem::Deinitialize()
 {
+	Indices.Empty();
 	Super::Deinitialize();
 }
 
@@ -39,6 +40,7 @@ UThirdwebMarketplace* UThirdwebMarketplaceSubsystem::RegisterMarketplace(const U
 			{
 				Subsystem->Marketplaces.Add(ChainId);
 			}
+			Subsystem->Indices.FindOrAdd(ChainId).FindOrAdd(Marketplace->GetContractAddress(), MakeShared<FThirdwebMarketplaceIndex>(ChainId, Marketplace->GetContractAddress()));
 			return Subsystem->Marketplaces[ChainId].FindOrAdd(Marketplace->GetContractAddress(), Marketplace);
 		}
 	}
@@ -55,6 +57,10 @@ void UThirdwebMarketplaceSubsystem::DeregisterMarketplace(const UObject* WorldCo
 			{
 				Subsystem->Marketplaces[ChainId].Remove(Marketplace->GetContractAddress());
 			}
+			if (TMap<FString, TSharedRef<FThirdwebMarketplaceIndex>>* ChainIndices = Subsystem->Indices.Find(Marketplace->GetChainId()))
+			{
+				ChainIndices->Remove(Marketplace->GetContractAddress());
+			}
 		}
 	}
 }
@@ -94,6 +100,60 @@ TArray<UThirdwebMarketplace*> UThirdwebMarketplaceSubsystem::GetAllMarketplaces(
 	return {};
 }
 
+void UThirdwebMarketplaceSubsystem::RefreshIndex(
+	const UObject* WorldContextObject,
+	const UThirdwebMarketplace* Marketplace,
+	const bool bFull,
+	const FSimpleDelegate& CompleteDelegate,
+	const FStringDelegate& ErrorDelegate
+)
+{
+	if (const TSharedPtr<FThirdwebMarketplaceIndex> Index = FindIndex(WorldContextObject, Marketplace))
+	{
+		Index->Refresh(Get(WorldContextObject), bFull, CompleteDelegate, ErrorDelegate);
+	}
+	else
+	{
+		EXECUTE_IF_BOUND(ErrorDelegate, TEXT("Marketplace not registered"))
+	}
+}
+
+TArray<FThirdwebMarketplaceDirectListing> UThirdwebMarketplaceSubsystem::QueryListings(const UObject* WorldContextObject, const UThirdwebMarketplace* Marketplace, const FThirdwebMarketplaceQuery& Query)
+{
+	const TSharedPtr<FThirdwebMarketplaceIndex> Index = FindIndex(WorldContextObject, Marketplace);
+	return Index ? Index->GetListings().Query(Query) : TArray<FThirdwebMarketplaceDirectListing>();
+}
+
+TArray<FThirdwebMarketplaceEnglishAuction> UThirdwebMarketplaceSubsystem::QueryAuctions(const UObject* WorldContextObject, const UThirdwebMarketplace* Marketplace, const FThirdwebMarketplaceQuery& Query)
+{
+	const TSharedPtr<FThirdwebMarketplaceIndex> Index = FindIndex(WorldContextObject, Marketplace);
+	return Index ? Index->GetAuctions().Query(Query) : TArray<FThirdwebMarketplaceEnglishAuction>();
+}
+
+TArray<FThirdwebMarketplaceOffer> UThirdwebMarketplaceSubsystem::QueryOffers(const UObject* WorldContextObject, const UThirdwebMarketplace* Marketplace, const FThirdwebMarketplaceQuery& Query)
+{
+	const TSharedPtr<FThirdwebMarketplaceIndex> Index = FindIndex(WorldContextObject, Marketplace);
+	return Index ? Index->GetOffers().Query(Query) : TArray<FThirdwebMarketplaceOffer>();
+}
+
+TSharedPtr<FThirdwebMarketplaceIndex> UThirdwebMarketplaceSubsystem::FindIndex(const UObject* WorldContextObject, const UThirdwebMarketplace* Marketplace)
+{
+	if (Marketplace)
+	{
+		if (UThirdwebMarketplaceSubsystem* Subsystem = Get(WorldContextObject))
+		{
+			if (const TMap<FString, TSharedRef<FThirdwebMarketplaceIndex>>* ChainIndices = Subsystem->Indices.Find(Marketplace->GetChainId()))
+			{
+				if (const TSharedRef<FThirdwebMarketplaceIndex>* Index = ChainIndices->Find(Marketplace->GetContractAddress()))
+				{
+					return *Index;
+				}
+			}
+		}
+	}
+	return nullptr;
+}
+
 UThirdwebMarketplaceSubsystem* UThirdwebMarketplaceSubsystem::Get(const UObject* WorldContextObject)
 {
 	if (UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject))
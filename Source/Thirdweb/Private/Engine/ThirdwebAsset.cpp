@@ -4,6 +4,7 @@
 
 #include "Dom/JsonObject.h"
 #include "Engine/Marketplace/ThirdwebMarketplaceCommon.h"
+#include "Internal/ThirdwebJsonReader.h"
 
 FThirdwebAssetCurrencyValue FThirdwebAssetCurrencyValue::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -34,6 +35,35 @@ FThirdwebAssetCurrencyValue FThirdwebAssetCurrencyValue::FromJson(const TSharedP
 	return CurrencyValue;
 }
 
+FThirdwebAssetCurrencyValue FThirdwebAssetCurrencyValue::FromJson(FThirdwebJsonReader& Reader)
+{
+	FThirdwebAssetCurrencyValue CurrencyValue;
+	Reader.ReadObject([&Reader, &CurrencyValue](const FUtf8StringView Key)
+	{
+		if (Key == UTF8TEXT("name"))
+		{
+			Reader.Read(CurrencyValue.Name);
+		}
+		else if (Key == UTF8TEXT("symbol"))
+		{
+			Reader.Read(CurrencyValue.Symbol);
+		}
+		else if (Key == UTF8TEXT("decimals"))
+		{
+			Reader.Read(CurrencyValue.Decimals);
+		}
+		else if (Key == UTF8TEXT("value"))
+		{
+			Reader.Read(CurrencyValue.Value);
+		}
+		else if (Key == UTF8TEXT("displayValue"))
+		{
+			Reader.Read(CurrencyValue.DisplayValue);
+		}
+	});
+	return CurrencyValue;
+}
+
 FThirdwebAssetAttribute FThirdwebAssetAttribute::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	FThirdwebAssetAttribute Attribute;
@@ -64,6 +94,23 @@ TArray<FThirdwebAssetAttribute> FThirdwebAssetAttribute::FromJson(const TArray<T
 	return Attributes;
 }
 
+FThirdwebAssetAttribute FThirdwebAssetAttribute::FromJson(FThirdwebJsonReader& Reader)
+{
+	FThirdwebAssetAttribute Attribute;
+	Reader.ReadObject([&Reader, &Attribute](const FUtf8StringView Key)
+	{
+		if (Key == UTF8TEXT("trait_type"))
+		{
+			Reader.Read(Attribute.TraitType);
+		}
+		else if (Key == UTF8TEXT("value"))
+		{
+			Reader.Read(Attribute.Value);
+		}
+	});
+	return Attribute;
+}
+
 FThirdwebAsset FThirdwebAsset::FromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	FThirdwebAsset Asset;
@@ -96,3 +143,36 @@ FThirdwebAsset FThirdwebAsset::FromJson(const TSharedPtr<FJsonObject>& JsonObjec
 	}
 	return Asset;
 }
+
+FThirdwebAsset FThirdwebAsset::FromJson(FThirdwebJsonReader& Reader)
+{
+	FThirdwebAsset Asset;
+	Reader.ReadObject([&Reader, &Asset](const FUtf8StringView Key)
+	{
+		if (Key == UTF8TEXT("id"))
+		{
+			Reader.Read(Asset.Id);
+		}
+		else if (Key == UTF8TEXT("uri"))
+		{
+			Reader.Read(Asset.Uri);
+		}
+		else if (Key == UTF8TEXT("name"))
+		{
+			Reader.Read(Asset.Name);
+		}
+		else if (Key == UTF8TEXT("description"))
+		{
+			Reader.Read(Asset.Description);
+		}
+		else if (Key == UTF8TEXT("external_url"))
+		{
+			Reader.Read(Asset.ExternalUrl);
+		}
+		else if (Key == UTF8TEXT("attributes") && Reader.Peek() == EJson::Array)
+		{
+			Asset.Attributes = Reader.ReadObjectArray<FThirdwebAssetAttribute>();
+		}
+	});
+	return Asset;
+}
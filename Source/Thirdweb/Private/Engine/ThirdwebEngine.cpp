@@ -2,8 +2,15 @@
 
 #include "Engine/ThirdwebEngine.h"
 
+#include "ThirdwebLog.h"
 #include "ThirdwebRuntimeSettings.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "Engine/ThirdwebEngineClient.h"
+#include "Internal/ThirdwebJsonReader.h"
 #include "Internal/ThirdwebURLSearchParams.h"
+#include "Tasks/Task.h"
 
 namespace ThirdwebEngine
 {
@@ -11,4 +18,107 @@ namespace ThirdwebEngine
 	{
 		return FString::Format(TEXT("{0}/{1}/{2}{3}"), {UThirdwebRuntimeSettings::GetEngineBaseUrl(), Base, Endpoint, Params.ToString(true)});
 	}
+
+	bool ParseResponse(const FHttpResponsePtr& Response, TSharedPtr<FJsonValue>& JsonValue, FString& Error)
+	{
+		return FThirdwebEngineClient::Get().ParseResponse(Response, JsonValue, Error);
+	}
+
+	bool ParseResponse(const FHttpResponsePtr& Response, TSharedPtr<FJsonObject>& JsonObject, FString& Error)
+	{
+		if (TSharedPtr<FJsonValue> JsonValue; ParseResponse(Response, JsonValue, Error))
+		{
+			JsonObject = JsonValue->AsObject();
+			return true;
+		}
+		return false;
+	}
+
+	bool ParseResponse(const FHttpResponsePtr& Response, TArray<TSharedPtr<FJsonValue>>& JsonArray, FString& Error)
+	{
+		if (TSharedPtr<FJsonValue> JsonValue; ParseResponse(Response, JsonValue, Error))
+		{
+			JsonArray = JsonValue->AsArray();
+			return true;
+		}
+		return false;
+	}
+
+	bool ReadEnvelope(const TConstArrayView<uint8> Content, TFunctionRef<void(FThirdwebJsonReader& Reader)> ReadResult, FString& Error)
+	{
+		FThirdwebJsonReader Reader(Content);
+		bool bHasResult = false;
+		bool bHasError = false;
+		Reader.ReadObject([&](const FUtf8StringView Key)
+		{
+			if (Key == UTF8TEXT("error") && Reader.Peek() == EJson::Object)
+			{
+				bHasError = true;
+				Error = TEXT("Unknown Error");
+				Reader.ReadObject([&Reader, &Error](const FUtf8StringView ErrorKey)
+				{
+					if (ErrorKey == UTF8TEXT("message"))
+					{
+						Reader.Read(Error);
+					}
+				});
+			}
+			else if (Key == UTF8TEXT("result"))
+			{
+				bHasResult = true;
+				ReadResult(Reader);
+			}
+		});
+
+		if (Reader.HasError())
+		{
+			TW_LOG(Warning, TEXT("ThirdwebEngine::ReadEnvelope::%s"), *Reader.GetError())
+			Error = TEXT("Invalid Response");
+			return false;
+		}
+		if (bHasError)
+		{
+			return false;
+		}
+		if (!bHasResult)
+		{
+			Error = TEXT("Invalid Response");
+			return false;
+		}
+		return true;
+	}
+
+	bool ReadResponse(const FHttpResponsePtr& Response, TFunctionRef<void(FThirdwebJsonReader& Reader)> ReadResult, FString& Error)
+	{
+		return FThirdwebEngineClient::Get().ReadResponse(Response, ReadResult, Error);
+	}
+
+	void DecodeAsync(const FHttpResponsePtr& Response, TUniqueFunction<TUniqueFunction<void()>()>&& Decode)
+	{
+		// Off the game thread already, or too small to be worth a round trip
+		if (!IsInGameThread() || !Response.IsValid() || Response->GetContent().Num() < UThirdwebRuntimeSettings::GetEngineAsyncDecodeThreshold())
+		{
+			Decode()();
+			return;
+		}
+		RunOnWorker([Decode = MoveTemp(Decode)]() mutable
+		{
+			RunOnGameThread(Decode());
+		});
+	}
+
+	void RunOnWorker(TUniqueFunction<void()>&& Function)
+	{
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Function));
+	}
+
+	void RunOnGameThread(TUniqueFunction<void()>&& Function)
+	{
+		if (IsInGameThread())
+		{
+			Function();
+			return;
+		}
+		FFunctionGraphTask::CreateAndDispatchWhenReady(MoveTemp(Function), TStatId(), nullptr, ENamedThreads::GameThread);
+	}
 }
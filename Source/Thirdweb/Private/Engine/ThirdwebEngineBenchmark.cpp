@@ -0,0 +1,163 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "ThirdwebLog.h"
+#include "ThirdwebUtils.h"
+#include "Dom/JsonValue.h"
+#include "Engine/ThirdwebEngine.h"
+#include "Engine/Marketplace/DirectListings/ThirdwebMarketplaceDirectListing.h"
+#include "Engine/Marketplace/EnglishAuctions/ThirdwebMarketplaceEnglishAuction.h"
+#include "Engine/Marketplace/Offers/ThirdwebMarketplaceOffer.h"
+#include "Engine/Transaction/ThirdwebEngineWriteJournal.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Internal/ThirdwebJsonReader.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace ThirdwebEngineBenchmark
+{
+	/** Decodes Content Iterations times through the FString/DOM path and through the direct UTF-8 path */
+	template <typename T>
+	void BenchmarkDecode(const TArray<uint8>& Content, const int32 Iterations)
+	{
+		int32 DomCount = 0;
+		int64 DomTransientBytes = 0;
+		const double DomStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; i++)
+		{
+			const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Content.GetData()), Content.Num());
+			const FString String(Converted.Length(), Converted.Get());
+			DomTransientBytes = String.GetAllocatedSize();
+			FString Error;
+			if (TArray<TSharedPtr<FJsonValue>> JsonArray; ThirdwebUtils::Json::ParseEngineResponse(String, JsonArray, Error))
+			{
+				DomCount = T::FromJson(JsonArray).Num();
+			}
+		}
+		const double DomSeconds = FPlatformTime::Seconds() - DomStart;
+
+		int32 DirectCount = 0;
+		const double DirectStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; i++)
+		{
+			FString Error;
+			ThirdwebEngine::ReadEnvelope(Content, [&DirectCount](FThirdwebJsonReader& Reader) { DirectCount = Reader.ReadObjectArray<T>().Num(); }, Error);
+		}
+		const double DirectSeconds = FPlatformTime::Seconds() - DirectStart;
+
+		TW_LOG(
+			Display,
+			TEXT("ThirdwebEngineBenchmark::Decode::Bytes=%d::Iterations=%d::Dom=%.3fms (%d entries, +%lld bytes widened before tokenizing)::Direct=%.3fms (%d entries)::Speedup=%.2fx"),
+			Content.Num(),
+			Iterations,
+			DomSeconds * 1000.0 / Iterations,
+			DomCount,
+			DomTransientBytes,
+			DirectSeconds * 1000.0 / Iterations,
+			DirectCount,
+			DirectSeconds > 0.0 ? DomSeconds / DirectSeconds : 0.0
+		)
+	}
+
+	static FAutoConsoleCommand DecodeCommand(
+		TEXT("thirdweb.Engine.BenchmarkDecode"),
+		TEXT("Compares FString/DOM and direct UTF-8 decoding of a recorded Engine GetAll response. Usage: thirdweb.Engine.BenchmarkDecode <Path> [listings|auctions|offers] [Iterations]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			if (Args.Num() < 1)
+			{
+				TW_LOG(Warning, TEXT("ThirdwebEngineBenchmark::Decode::Missing payload path"))
+				return;
+			}
+			TArray<uint8> Content;
+			if (!FFileHelper::LoadFileToArray(Content, *Args[0]))
+			{
+				TW_LOG(Warning, TEXT("ThirdwebEngineBenchmark::Decode::Could not read %s"), *Args[0])
+				return;
+			}
+			const FString Type = Args.Num() > 1 ? Args[1] : TEXT("listings");
+			const int32 Iterations = Args.Num() > 2 ? FMath::Max(1, FCString::Atoi(*Args[2])) : 100;
+			if (Type.Equals(TEXT("auctions")))
+			{
+				BenchmarkDecode<FThirdwebMarketplaceEnglishAuction>(Content, Iterations);
+			}
+			else if (Type.Equals(TEXT("offers")))
+			{
+				BenchmarkDecode<FThirdwebMarketplaceOffer>(Content, Iterations);
+			}
+			else
+			{
+				BenchmarkDecode<FThirdwebMarketplaceDirectListing>(Content, Iterations);
+			}
+		})
+	);
+
+	/** Journals and answers Count writes shaped like a typical contract write in a scratch journal */
+	void BenchmarkWriteJournal(const int32 Count)
+	{
+		const FString Path = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Thirdweb"), TEXT("Engine"), TEXT("WriteJournalBenchmark.jsonl"));
+		IFileManager::Get().Delete(*Path);
+
+		TArray<FString> Keys;
+		Keys.Reserve(Count);
+		for (int32 i = 0; i < Count; i++)
+		{
+			Keys.Add(FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower));
+		}
+		TMap<FString, FString> Headers;
+		Headers.Add(TEXT("x-backend-wallet-address"), TEXT("0x8a3D5E6fB1cC4e9B2f7A0d5C3e1B9f4A6c8D2e70"));
+		const FString Url = TEXT("https://engine.example.com/contract/137/0x5B8a1D6F4c2E9b3A7d0C8e1F6a4B2c9D3e7F0a15/write");
+		const FString Body = TEXT("{\"functionName\":\"mintTo\",\"args\":[\"0x3C44CdDdB6a900fa2b585dd299e03d12FA4293BC\",\"1000000000000000000\"]}");
+
+		double AppendSeconds;
+		double AnswerSeconds;
+		int64 Bytes;
+		{
+			FThirdwebEngineWriteJournal Journal(Path);
+			// The first append opens the file, which is not part of the per write cost
+			Journal.Append(TEXT("warmup"), Url, Headers, Body);
+			Journal.Acknowledge(TEXT("warmup"), TEXT("warmup"));
+
+			const double AppendStart = FPlatformTime::Seconds();
+			for (const FString& Key : Keys)
+			{
+				Journal.Append(Key, Url, Headers, Body);
+			}
+			AppendSeconds = FPlatformTime::Seconds() - AppendStart;
+
+			const double AnswerStart = FPlatformTime::Seconds();
+			for (const FString& Key : Keys)
+			{
+				Journal.Acknowledge(Key, Key);
+			}
+			AnswerSeconds = FPlatformTime::Seconds() - AnswerStart;
+			Bytes = IFileManager::Get().FileSize(*Path);
+		}
+		IFileManager::Get().Delete(*Path);
+
+		TW_LOG(
+			Display,
+			TEXT("ThirdwebEngineBenchmark::WriteJournal::Writes=%d::Append=%.2fus (%.0f/s)::Acknowledge=%.2fus (%.0f/s)::Bytes=%lld"),
+			Count,
+			AppendSeconds * 1000000.0 / Count,
+			AppendSeconds > 0.0 ? Count / AppendSeconds : 0.0,
+			AnswerSeconds * 1000000.0 / Count,
+			AnswerSeconds > 0.0 ? Count / AnswerSeconds : 0.0,
+			Bytes
+		)
+	}
+
+	static FAutoConsoleCommand WriteJournalCommand(
+		TEXT("thirdweb.Engine.BenchmarkWriteJournal"),
+		TEXT("Measures the cost of journaling and acknowledging Engine writes. Usage: thirdweb.Engine.BenchmarkWriteJournal [Writes]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			BenchmarkWriteJournal(Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000);
+		})
+	);
+}
+
+#endif
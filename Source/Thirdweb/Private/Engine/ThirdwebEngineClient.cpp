@@ -0,0 +1,602 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/ThirdwebEngineClient.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebMacros.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "ThirdwebUtils.h"
+#include "Containers/Ticker.h"
+#include "Engine/ThirdwebEngine.h"
+#include "Misc/ScopeLock.h"
+
+namespace ThirdwebEngineClient
+{
+	// Shared results older than this are assumed to have lost a waiter and are dropped
+	static constexpr double SharedResultLifetime = 30.0;
+
+	// Upper bound on a server-provided Retry-After
+	static constexpr float MaxRetryAfter = 60.0f;
+}
+
+FThirdwebEngineClient& FThirdwebEngineClient::Get()
+{
+	static FThirdwebEngineClient Client;
+	return Client;
+}
+
+void FThirdwebEngineClient::ProcessRequest(const TSharedRef<IHttpRequest>& Request)
+{
+	const FHttpRequestCompleteDelegate Delegate = Request->OnProcessRequestComplete();
+	if (IsCoalescable(Request))
+	{
+		if (ServeFromCache(Request, Delegate))
+		{
+			return;
+		}
+		const FString Key = MakeCoalescingKey(Request);
+		FScopeLock ScopeLock(&Lock);
+		if (TArray<FHttpRequestCompleteDelegate>* Waiters = InFlightReads.Find(Key))
+		{
+			Waiters->Emplace(Delegate);
+			CoalescedCount++;
+			TW_LOG(VeryVerbose, TEXT("FThirdwebEngineClient::ProcessRequest::Coalesced::Url=%s::Waiters=%d"), *Request->GetURL(), Waiters->Num())
+			return;
+		}
+		InFlightReads.Add(Key, {Delegate});
+		ScopeLock.Unlock();
+		Enqueue({Request, FHttpRequestCompleteDelegate::CreateRaw(this, &FThirdwebEngineClient::OnCoalescedRequestComplete, Key)});
+		return;
+	}
+	Enqueue({Request, FHttpRequestCompleteDelegate::CreateRaw(this, &FThirdwebEngineClient::OnRequestComplete, Delegate)});
+}
+
+bool FThirdwebEngineClient::ParseResponse(const FHttpResponsePtr& Response, TSharedPtr<FJsonValue>& JsonValue, FString& Error)
+{
+	TSharedPtr<FSharedResult, ESPMode::ThreadSafe> Shared;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (const TSharedRef<FSharedResult, ESPMode::ThreadSafe>* Found = SharedResults.Find(Response))
+		{
+			Shared = *Found;
+		}
+	}
+	if (!Shared.IsValid())
+	{
+		return ParseResponseInternal(Response, JsonValue, Error);
+	}
+
+	bool bSuccess;
+	{
+		FScopeLock ResultLock(&Shared->Lock);
+		if (!Shared->bParsed)
+		{
+			Shared->bSuccess = ParseResponseInternal(Response, Shared->JsonValue, Shared->Error);
+			Shared->bParsed = true;
+		}
+		JsonValue = Shared->JsonValue;
+		Error = Shared->Error;
+		bSuccess = Shared->bSuccess;
+	}
+	ReleaseSharedResult(Response);
+	return bSuccess;
+}
+
+bool FThirdwebEngineClient::ReadResponse(const FHttpResponsePtr& Response, TFunctionRef<void(FThirdwebJsonReader& Reader)> ReadResult, FString& Error)
+{
+	if (!Response.IsValid())
+	{
+		Error = TEXT("Invalid Response");
+		return false;
+	}
+	TW_LOG(Verbose, TEXT("FThirdwebEngineClient::ReadResponse::Url=%s::Content=%s"), *Response->GetURL(), *Response->GetContentAsString())
+
+	const bool bSuccess = ThirdwebEngine::ReadEnvelope(Response->GetContent(), ReadResult, Error);
+	// Coalesced waiters reading the raw body no longer need the shared DOM
+	ReleaseSharedResult(Response);
+	return bSuccess;
+}
+
+void FThirdwebEngineClient::Warmup()
+{
+	const FString BaseUrl = UThirdwebRuntimeSettings::GetEngineBaseUrl();
+	if (BaseUrl.IsEmpty())
+	{
+		return;
+	}
+	const TSharedRef<IHttpRequest> Request = ThirdwebUtils::Internal::CreateEngineRequest();
+	Request->SetURL(BaseUrl + TEXT("/system/health"));
+	Request->OnProcessRequestComplete().BindLambda([](HTTP_LAMBDA_PARAMS)
+	{
+		TW_LOG(Verbose, TEXT("FThirdwebEngineClient::Warmup::Connected=%s::Code=%d"), bConnectedSuccessfully ? TEXT("true") : TEXT("false"), Response.IsValid() ? Response->GetResponseCode() : 0)
+	});
+	ProcessRequest(Request);
+}
+
+void FThirdwebEngineClient::InvalidateCache(const FString& ContractAddress)
+{
+	TArray<FHttpResponsePtr> Removed;
+	ResponseCache.Invalidate(ContractAddress, Removed);
+	UnpinRemoved(Removed);
+}
+
+FThirdwebEngineResponseCache::FStats FThirdwebEngineClient::GetCacheStats() const
+{
+	return ResponseCache.GetStats();
+}
+
+bool FThirdwebEngineClient::IsCircuitOpen(const FString& Host) const
+{
+	return Endpoints.IsCircuitOpen(Host);
+}
+
+TArray<FThirdwebEngineEndpoints::FStats> FThirdwebEngineClient::GetEndpointStats() const
+{
+	return Endpoints.GetStats();
+}
+
+int32 FThirdwebEngineClient::GetQueueDepth() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return PendingRequests.Num() - PendingHead;
+}
+
+int32 FThirdwebEngineClient::GetInFlightCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return InFlightCount;
+}
+
+int64 FThirdwebEngineClient::GetCoalescedCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return CoalescedCount;
+}
+
+bool FThirdwebEngineClient::IsCoalescable(const TSharedRef<IHttpRequest>& Request)
+{
+	return Request->GetVerb().Equals(TEXT("GET"), ESearchCase::IgnoreCase);
+}
+
+FString FThirdwebEngineClient::MakeCoalescingKey(const TSharedRef<IHttpRequest>& Request)
+{
+	return Request->GetURL() + TEXT("|") + Request->GetHeader(TEXT("authorization"));
+}
+
+bool FThirdwebEngineClient::ParseResponseInternal(const FHttpResponsePtr& Response, TSharedPtr<FJsonValue>& JsonValue, FString& Error)
+{
+	if (!Response.IsValid())
+	{
+		Error = TEXT("Invalid Response");
+		return false;
+	}
+	const FString Content = Response->GetContentAsString();
+	TW_LOG(Verbose, TEXT("FThirdwebEngineClient::ParseResponse::Url=%s::Content=%s"), *Response->GetURL(), *Content)
+	return ThirdwebUtils::Json::ParseEngineResponse(Content, JsonValue, Error);
+}
+
+bool FThirdwebEngineClient::IsSuccessful(const FHttpResponsePtr& Response, const bool bConnectedSuccessfully)
+{
+	return bConnectedSuccessfully && Response.IsValid() && EHttpResponseCodes::IsOk(Response->GetResponseCode());
+}
+
+bool FThirdwebEngineClient::IsIdempotent(const FHttpRequestPtr& Request)
+{
+	return Request.IsValid() && (Request->GetVerb().Equals(TEXT("GET"), ESearchCase::IgnoreCase) || !Request->GetHeader(TEXT("x-idempotency-key")).IsEmpty());
+}
+
+bool FThirdwebEngineClient::IsRetryable(const FHttpResponsePtr& Response, const bool bConnectedSuccessfully)
+{
+	if (!bConnectedSuccessfully || !Response.IsValid())
+	{
+		return true;
+	}
+	switch (Response->GetResponseCode())
+	{
+	case EHttpResponseCodes::RequestTimeout:
+	case EHttpResponseCodes::TooManyRequests:
+	case EHttpResponseCodes::BadGateway:
+	case EHttpResponseCodes::ServiceUnavail:
+	case EHttpResponseCodes::GatewayTimeout:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool FThirdwebEngineClient::IsHostFailure(const FHttpResponsePtr& Response, const bool bConnectedSuccessfully)
+{
+	return !bConnectedSuccessfully || !Response.IsValid() || Response->GetResponseCode() >= EHttpResponseCodes::ServerError;
+}
+
+float FThirdwebEngineClient::GetRetryDelay(const FHttpResponsePtr& Response, const int32 Attempt)
+{
+	if (Response.IsValid())
+	{
+		const int32 Code = Response->GetResponseCode();
+		if (const FString RetryAfter = Response->GetHeader(TEXT("Retry-After")); !RetryAfter.IsEmpty() && (Code == EHttpResponseCodes::TooManyRequests || Code == EHttpResponseCodes::ServiceUnavail))
+		{
+			if (RetryAfter.IsNumeric())
+			{
+				return FMath::Clamp(FCString::Atof(*RetryAfter), 0.0f, ThirdwebEngineClient::MaxRetryAfter);
+			}
+			if (FDateTime Date; FDateTime::ParseHttpDate(RetryAfter, Date))
+			{
+				return FMath::Clamp(static_cast<float>((Date - FDateTime::UtcNow()).GetTotalSeconds()), 0.0f, ThirdwebEngineClient::MaxRetryAfter);
+			}
+		}
+	}
+	// Full jitter: uniform in [0, min(Max, Base * 2^Attempt)]
+	const float Ceiling = FMath::Min(UThirdwebRuntimeSettings::GetEngineRetryMaxDelay(), UThirdwebRuntimeSettings::GetEngineRetryBaseDelay() * FMath::Pow(2.0f, Attempt));
+	return FMath::FRandRange(0.0f, Ceiling);
+}
+
+bool FThirdwebEngineClient::HasFreeSlot() const
+{
+	const int32 MaxConcurrentRequests = UThirdwebRuntimeSettings::GetEngineMaxConcurrentRequests();
+	return MaxConcurrentRequests <= 0 || InFlightCount < MaxConcurrentRequests;
+}
+
+void FThirdwebEngineClient::Enqueue(FPendingRequest&& Pending)
+{
+	if (!Endpoints.HasAvailable())
+	{
+		TW_LOG(Warning, TEXT("FThirdwebEngineClient::Enqueue::Circuit open, failing request to %s"), *Pending.Request->GetURL())
+		Pending.OnComplete.ExecuteIfBound(Pending.Request, nullptr, false);
+		return;
+	}
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (!HasFreeSlot())
+		{
+			PendingRequests.Emplace(MoveTemp(Pending));
+			TW_LOG(VeryVerbose, TEXT("FThirdwebEngineClient::Enqueue::Queued::QueueDepth=%d"), PendingRequests.Num() - PendingHead)
+			return;
+		}
+		InFlightCount++;
+	}
+	Dispatch(Pending);
+}
+
+void FThirdwebEngineClient::Dispatch(const FPendingRequest& Pending)
+{
+	const TSharedRef<FAttempt, ESPMode::ThreadSafe> Attempt = MakeShared<FAttempt, ESPMode::ThreadSafe>(Pending);
+	Send(Attempt, Pending.Request);
+
+	const float HedgeDelay = UThirdwebRuntimeSettings::GetEngineHedgeDelay();
+	if (HedgeDelay > 0.0f && IsCoalescable(Pending.Request) && Endpoints.Num() > 1)
+	{
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Attempt](float)
+		{
+			Hedge(Attempt);
+			return false;
+		}), HedgeDelay);
+	}
+}
+
+bool FThirdwebEngineClient::Send(const TSharedRef<FAttempt, ESPMode::ThreadSafe>& Attempt, const TSharedRef<IHttpRequest>& Request, const FString& ExcludeBaseUrl)
+{
+	bool bProbe;
+	const FString BaseUrl = Endpoints.Acquire(ExcludeBaseUrl, bProbe);
+	if (!ExcludeBaseUrl.IsEmpty() && BaseUrl.IsEmpty())
+	{
+		return false;
+	}
+	Request->SetURL(FThirdwebEngineEndpoints::Rewrite(Attempt->Url, BaseUrl));
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (Attempt->Sends.Num() == 0)
+		{
+			Attempt->FirstBaseUrl = BaseUrl;
+		}
+		Attempt->Sends.Emplace(Request);
+		Attempt->Outstanding++;
+	}
+	Request->OnProcessRequestComplete().BindRaw(this, &FThirdwebEngineClient::OnSendComplete, Attempt, BaseUrl, bProbe, FPlatformTime::Seconds());
+	if (!Request->ProcessRequest())
+	{
+		TW_LOG(Warning, TEXT("FThirdwebEngineClient::Send::Failed to start request to %s"), *Request->GetURL())
+	}
+	return true;
+}
+
+void FThirdwebEngineClient::Hedge(const TSharedRef<FAttempt, ESPMode::ThreadSafe>& Attempt)
+{
+	FString FirstBaseUrl;
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (Attempt->bDone || Attempt->FirstBaseUrl.IsEmpty())
+		{
+			return;
+		}
+		FirstBaseUrl = Attempt->FirstBaseUrl;
+	}
+	if (Send(Attempt, CloneRequest(Attempt->Pending.Request), FirstBaseUrl))
+	{
+		TW_LOG(Verbose, TEXT("FThirdwebEngineClient::Hedge::Url=%s"), *Attempt->Url)
+	}
+}
+
+void FThirdwebEngineClient::OnSendComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, TSharedRef<FAttempt, ESPMode::ThreadSafe> Attempt, FString BaseUrl, bool bProbe, double StartTime)
+{
+	bool bCancelled = false;
+	bool bComplete = false;
+	TArray<TSharedRef<IHttpRequest>> Siblings;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Attempt->Outstanding--;
+		if (Attempt->bDone)
+		{
+			// Lost the race against a hedge and was cancelled
+			bCancelled = true;
+		}
+		else if (IsSuccessful(Response, bConnectedSuccessfully) || Attempt->Outstanding == 0)
+		{
+			// A failed send only completes the attempt if no other send can still succeed
+			Attempt->bDone = true;
+			bComplete = true;
+			Siblings = Attempt->Sends;
+		}
+	}
+	Endpoints.Release(BaseUrl, IsHostFailure(Response, bConnectedSuccessfully), FPlatformTime::Seconds() - StartTime, bCancelled, bProbe);
+	if (!bComplete)
+	{
+		return;
+	}
+
+	for (const TSharedRef<IHttpRequest>& Sibling : Siblings)
+	{
+		if (&Sibling.Get() != Request.Get())
+		{
+			Sibling->CancelRequest();
+		}
+	}
+	// Coalescing, caching and retries all work on the canonical URL
+	Request->SetURL(Attempt->Url);
+	OnAttemptComplete(Attempt->Pending, Request, Response, bConnectedSuccessfully);
+}
+
+void FThirdwebEngineClient::OnAttemptComplete(const FPendingRequest& Pending, FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully)
+{
+	if (Pending.Attempt < UThirdwebRuntimeSettings::GetEngineMaxRetries() && IsIdempotent(Request) && IsRetryable(Response, bConnectedSuccessfully))
+	{
+		const float Delay = GetRetryDelay(Response, Pending.Attempt);
+		TW_LOG(Verbose, TEXT("FThirdwebEngineClient::OnAttemptComplete::Retrying %s in %.2fs::Attempt=%d::Code=%d"), *Request->GetURL(), Delay, Pending.Attempt + 1, Response.IsValid() ? Response->GetResponseCode() : 0)
+		ReleaseSlot();
+		ScheduleRetry({CloneRequest(Request.ToSharedRef()), Pending.OnComplete, Pending.Attempt + 1}, Delay);
+		return;
+	}
+
+	Pending.OnComplete.ExecuteIfBound(Request, Response, bConnectedSuccessfully);
+	ReleaseSlot();
+}
+
+void FThirdwebEngineClient::OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FHttpRequestCompleteDelegate Delegate)
+{
+	if (Request.IsValid() && IsSuccessful(Response, bConnectedSuccessfully))
+	{
+		InvalidateContractsInUrl(Request->GetURL());
+	}
+	Delegate.ExecuteIfBound(Request, Response, bConnectedSuccessfully);
+}
+
+void FThirdwebEngineClient::OnCoalescedRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString Key)
+{
+	TArray<FHttpRequestCompleteDelegate> Waiters;
+	{
+		FScopeLock ScopeLock(&Lock);
+		InFlightReads.RemoveAndCopyValue(Key, Waiters);
+	}
+	if (Request.IsValid() && IsSuccessful(Response, bConnectedSuccessfully))
+	{
+		StoreInCache(Request->GetURL(), Response);
+	}
+
+	const bool bShared = Waiters.Num() > 1 && bConnectedSuccessfully && Response.IsValid();
+	if (bShared)
+	{
+		ShareResult(Response, Waiters.Num());
+	}
+	for (const FHttpRequestCompleteDelegate& Waiter : Waiters)
+	{
+		// Waiters whose owner has gone away will never parse the response
+		if (!Waiter.ExecuteIfBound(Request, Response, bConnectedSuccessfully) && bShared)
+		{
+			ReleaseSharedResult(Response);
+		}
+	}
+}
+
+void FThirdwebEngineClient::ScheduleRetry(FPendingRequest&& Pending, const float Delay)
+{
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Pending = MoveTemp(Pending)](float) mutable
+	{
+		Enqueue(MoveTemp(Pending));
+		return false;
+	}), Delay);
+}
+
+void FThirdwebEngineClient::ReleaseSlot()
+{
+	{
+		FScopeLock ScopeLock(&Lock);
+		InFlightCount = FMath::Max(0, InFlightCount - 1);
+	}
+	DispatchPending();
+}
+
+void FThirdwebEngineClient::DispatchPending()
+{
+	TArray<FPendingRequest> Ready;
+	{
+		FScopeLock ScopeLock(&Lock);
+		while (PendingHead < PendingRequests.Num() && HasFreeSlot())
+		{
+			Ready.Emplace(MoveTemp(PendingRequests[PendingHead++]));
+			InFlightCount++;
+		}
+		// Dequeuing only advances the head. Dispatched entries are dropped once they make up half of the array, which
+		// keeps the cost of moving the rest down constant per request
+		if (PendingHead == PendingRequests.Num())
+		{
+			PendingRequests.Reset();
+			PendingHead = 0;
+		}
+		else if (PendingHead > 0 && PendingHead * 2 >= PendingRequests.Num())
+		{
+			PendingRequests.RemoveAt(0, PendingHead);
+			PendingHead = 0;
+		}
+	}
+	for (const FPendingRequest& Pending : Ready)
+	{
+		Dispatch(Pending);
+	}
+}
+
+bool FThirdwebEngineClient::ServeFromCache(const TSharedRef<IHttpRequest>& Request, const FHttpRequestCompleteDelegate& Delegate)
+{
+	const FString Url = Request->GetURL();
+	if (FThirdwebEngineResponseCache::GetTTL(Url) <= 0.0f)
+	{
+		return false;
+	}
+
+	FHttpResponsePtr Response;
+	bool bShouldRevalidate;
+	if (ResponseCache.Find(Url, Response, bShouldRevalidate) == FThirdwebEngineResponseCache::ELookup::Miss)
+	{
+		return false;
+	}
+	if (bShouldRevalidate)
+	{
+		Revalidate(Request);
+	}
+
+	TW_LOG(VeryVerbose, TEXT("FThirdwebEngineClient::ServeFromCache::Url=%s"), *Url)
+	ShareResult(Response, 1);
+	if (!Delegate.ExecuteIfBound(Request, Response, true))
+	{
+		ReleaseSharedResult(Response);
+	}
+	return true;
+}
+
+void FThirdwebEngineClient::Revalidate(const TSharedRef<IHttpRequest>& Request)
+{
+	// The refreshed response replaces the stale entry when it arrives
+	const TSharedRef<IHttpRequest> Refresh = CloneRequest(Request);
+	const FString Key = MakeCoalescingKey(Refresh);
+	{
+		FScopeLock ScopeLock(&Lock);
+		if (InFlightReads.Contains(Key))
+		{
+			return;
+		}
+		InFlightReads.Add(Key, {});
+	}
+	Enqueue({Refresh, FHttpRequestCompleteDelegate::CreateRaw(this, &FThirdwebEngineClient::OnCoalescedRequestComplete, Key)});
+}
+
+void FThirdwebEngineClient::StoreInCache(const FString& Url, const FHttpResponsePtr& Response)
+{
+	const float TTL = FThirdwebEngineResponseCache::GetTTL(Url);
+	if (TTL <= 0.0f)
+	{
+		return;
+	}
+	// Pin the decoded result so cache hits do not parse the response again
+	ShareResult(Response, 0, true);
+	TArray<FHttpResponsePtr> Removed;
+	if (!ResponseCache.Put(Url, Response, TTL, Removed))
+	{
+		Removed.Emplace(Response);
+	}
+	UnpinRemoved(Removed);
+}
+
+void FThirdwebEngineClient::InvalidateContractsInUrl(const FString& Url)
+{
+	TArray<FString> Segments;
+	Url.ParseIntoArray(Segments, TEXT("/"));
+	for (const FString& Segment : Segments)
+	{
+		if (ThirdwebUtils::IsValidAddress(Segment))
+		{
+			InvalidateCache(Segment);
+		}
+	}
+}
+
+void FThirdwebEngineClient::UnpinRemoved(const TArray<FHttpResponsePtr>& Removed)
+{
+	for (const FHttpResponsePtr& Response : Removed)
+	{
+		UnpinSharedResult(Response);
+	}
+}
+
+TSharedRef<IHttpRequest> FThirdwebEngineClient::CloneRequest(const TSharedRef<IHttpRequest>& Request)
+{
+	const TSharedRef<IHttpRequest> Clone = ThirdwebUtils::Internal::CreateEngineRequest(Request->GetVerb());
+	Clone->SetURL(Request->GetURL());
+	for (const FString& Header : Request->GetAllHeaders())
+	{
+		if (FString Name, Value; Header.Split(TEXT(": "), &Name, &Value))
+		{
+			Clone->SetHeader(Name, Value);
+		}
+	}
+	Clone->SetContent(Request->GetContent());
+	return Clone;
+}
+
+void FThirdwebEngineClient::ShareResult(const FHttpResponsePtr& Response, const int32 Waiters, const bool bPin)
+{
+	const double Now = FPlatformTime::Seconds();
+	FScopeLock ScopeLock(&Lock);
+	for (auto It = SharedResults.CreateIterator(); It; ++It)
+	{
+		if (!It.Value()->bPinned && Now - It.Value()->CreatedAt > ThirdwebEngineClient::SharedResultLifetime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	if (const TSharedRef<FSharedResult, ESPMode::ThreadSafe>* Existing = SharedResults.Find(Response))
+	{
+		(*Existing)->Waiters += Waiters;
+		(*Existing)->bPinned |= bPin;
+		return;
+	}
+	const TSharedRef<FSharedResult, ESPMode::ThreadSafe> Shared = MakeShared<FSharedResult, ESPMode::ThreadSafe>();
+	Shared->Waiters = Waiters;
+	Shared->bPinned = bPin;
+	Shared->CreatedAt = Now;
+	SharedResults.Add(Response, Shared);
+}
+
+void FThirdwebEngineClient::ReleaseSharedResult(const FHttpResponsePtr& Response)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (const TSharedRef<FSharedResult, ESPMode::ThreadSafe>* Found = SharedResults.Find(Response))
+	{
+		(*Found)->Waiters = FMath::Max(0, (*Found)->Waiters - 1);
+		if ((*Found)->Waiters == 0 && !(*Found)->bPinned)
+		{
+			SharedResults.Remove(Response);
+		}
+	}
+}
+
+void FThirdwebEngineClient::UnpinSharedResult(const FHttpResponsePtr& Response)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (const TSharedRef<FSharedResult, ESPMode::ThreadSafe>* Found = SharedResults.Find(Response))
+	{
+		(*Found)->bPinned = false;
+		if ((*Found)->Waiters == 0)
+		{
+			SharedResults.Remove(Response);
+		}
+	}
+}
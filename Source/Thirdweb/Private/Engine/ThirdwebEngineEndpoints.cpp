@@ -0,0 +1,232 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/ThirdwebEngineEndpoints.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "PlatformHttp.h"
+#include "Misc/ScopeLock.h"
+
+namespace ThirdwebEngineEndpoints
+{
+	// Weight of the latest sample in the error rate and latency moving averages
+	static constexpr double Smoothing = 0.2;
+
+	// Samples needed before an endpoint can be ejected
+	static constexpr int32 MinSamples = 5;
+}
+
+bool FThirdwebEngineEndpoints::HasAvailable()
+{
+	FScopeLock ScopeLock(&Lock);
+	Refresh();
+	if (Endpoints.Num() == 0)
+	{
+		return true;
+	}
+	const double Now = FPlatformTime::Seconds();
+	for (const FEndpoint& Endpoint : Endpoints)
+	{
+		if (IsCircuitAccepting(Endpoint, Now))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FString FThirdwebEngineEndpoints::Acquire(const FString& Exclude, bool& bOutProbe)
+{
+	bOutProbe = false;
+	FScopeLock ScopeLock(&Lock);
+	Refresh();
+
+	const double Now = FPlatformTime::Seconds();
+	FEndpoint* Best = nullptr;
+	bool bBestHealthy = false;
+	for (FEndpoint& Endpoint : Endpoints)
+	{
+		if (Endpoint.BaseUrl.Equals(Exclude) || !IsCircuitAccepting(Endpoint, Now))
+		{
+			continue;
+		}
+		if (Endpoint.EjectedUntil > 0.0 && Now >= Endpoint.EjectedUntil)
+		{
+			TW_LOG(Log, TEXT("FThirdwebEngineEndpoints::Acquire::Readmitting %s"), *Endpoint.BaseUrl)
+			Endpoint.EjectedUntil = 0.0;
+			Endpoint.Samples = 0;
+			Endpoint.ErrorRate = 0.0;
+			Endpoint.Latency = 0.0;
+		}
+		// Ejected endpoints are only used when nothing healthy is left
+		const bool bHealthy = Endpoint.EjectedUntil <= 0.0;
+		if (!Best
+			|| (bHealthy && !bBestHealthy)
+			|| (bHealthy == bBestHealthy && (Endpoint.Outstanding < Best->Outstanding || (Endpoint.Outstanding == Best->Outstanding && Endpoint.Latency < Best->Latency))))
+		{
+			Best = &Endpoint;
+			bBestHealthy = bHealthy;
+		}
+	}
+	if (!Best)
+	{
+		return TEXT("");
+	}
+	if (Best->OpenUntil > 0.0)
+	{
+		// Half open: this request is the probe
+		Best->bProbing = true;
+		bOutProbe = true;
+	}
+	Best->Outstanding++;
+	return Best->BaseUrl;
+}
+
+void FThirdwebEngineEndpoints::Release(const FString& BaseUrl, const bool bFailure, const double Latency, const bool bCancelled, const bool bProbe)
+{
+	FScopeLock ScopeLock(&Lock);
+	FEndpoint* Endpoint = Find(BaseUrl);
+	if (!Endpoint)
+	{
+		return;
+	}
+	Endpoint->Outstanding = FMath::Max(0, Endpoint->Outstanding - 1);
+	if (bCancelled)
+	{
+		// A cancelled probe gave no verdict, so the next request may probe again. Other cancelled sends leave it alone
+		if (bProbe)
+		{
+			Endpoint->bProbing = false;
+		}
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	Endpoint->Samples++;
+	Endpoint->ErrorRate += ThirdwebEngineEndpoints::Smoothing * ((bFailure ? 1.0 : 0.0) - Endpoint->ErrorRate);
+	if (!bFailure)
+	{
+		Endpoint->Latency += ThirdwebEngineEndpoints::Smoothing * (Latency - Endpoint->Latency);
+	}
+
+	// Circuit breaker
+	if (const int32 Threshold = UThirdwebRuntimeSettings::GetEngineCircuitBreakerThreshold(); Threshold > 0)
+	{
+		if (!bFailure)
+		{
+			if (Endpoint->OpenUntil > 0.0)
+			{
+				TW_LOG(Log, TEXT("FThirdwebEngineEndpoints::Release::Circuit closed for %s"), *BaseUrl)
+			}
+			Endpoint->ConsecutiveFailures = 0;
+			Endpoint->OpenUntil = 0.0;
+			Endpoint->bProbing = false;
+		}
+		else if (++Endpoint->ConsecutiveFailures >= Threshold || Endpoint->bProbing)
+		{
+			Endpoint->OpenUntil = Now + UThirdwebRuntimeSettings::GetEngineCircuitBreakerCooldown();
+			Endpoint->bProbing = false;
+			TW_LOG(Warning, TEXT("FThirdwebEngineEndpoints::Release::Circuit opened for %s after %d consecutive failures"), *BaseUrl, Endpoint->ConsecutiveFailures)
+		}
+	}
+
+	// Outlier ejection, as long as another endpoint stays in rotation
+	if (Endpoints.Num() > 1 && Endpoint->EjectedUntil <= 0.0 && Endpoint->Samples >= ThirdwebEngineEndpoints::MinSamples)
+	{
+		const float MaxLatency = UThirdwebRuntimeSettings::GetEngineEjectionLatency();
+		if (Endpoint->ErrorRate > UThirdwebRuntimeSettings::GetEngineEjectionErrorRate() || (MaxLatency > 0.0f && Endpoint->Latency > MaxLatency))
+		{
+			int32 Healthy = 0;
+			for (const FEndpoint& Other : Endpoints)
+			{
+				Healthy += Other.EjectedUntil <= 0.0 ? 1 : 0;
+			}
+			if (Healthy > 1)
+			{
+				Endpoint->EjectedUntil = Now + UThirdwebRuntimeSettings::GetEngineEjectionDuration();
+				TW_LOG(Warning, TEXT("FThirdwebEngineEndpoints::Release::Ejecting %s::ErrorRate=%.2f::Latency=%.3fs"), *BaseUrl, Endpoint->ErrorRate, Endpoint->Latency)
+			}
+		}
+	}
+}
+
+FString FThirdwebEngineEndpoints::Rewrite(const FString& Url, const FString& BaseUrl)
+{
+	const FString PrimaryBaseUrl = UThirdwebRuntimeSettings::GetEngineBaseUrl();
+	if (BaseUrl.IsEmpty() || BaseUrl.Equals(PrimaryBaseUrl) || !Url.StartsWith(PrimaryBaseUrl))
+	{
+		return Url;
+	}
+	return BaseUrl + Url.RightChop(PrimaryBaseUrl.Len());
+}
+
+int32 FThirdwebEngineEndpoints::Num()
+{
+	FScopeLock ScopeLock(&Lock);
+	Refresh();
+	return Endpoints.Num();
+}
+
+TArray<FThirdwebEngineEndpoints::FStats> FThirdwebEngineEndpoints::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	const double Now = FPlatformTime::Seconds();
+	TArray<FStats> Stats;
+	for (const FEndpoint& Endpoint : Endpoints)
+	{
+		FStats& Entry = Stats.AddDefaulted_GetRef();
+		Entry.BaseUrl = Endpoint.BaseUrl;
+		Entry.Outstanding = Endpoint.Outstanding;
+		Entry.ErrorRate = Endpoint.ErrorRate;
+		Entry.Latency = Endpoint.Latency;
+		Entry.bEjected = Endpoint.EjectedUntil > Now;
+		Entry.bCircuitOpen = Endpoint.OpenUntil > 0.0;
+	}
+	return Stats;
+}
+
+bool FThirdwebEngineEndpoints::IsCircuitOpen(const FString& Host) const
+{
+	FScopeLock ScopeLock(&Lock);
+	for (const FEndpoint& Endpoint : Endpoints)
+	{
+		if (Endpoint.OpenUntil > 0.0 && FPlatformHttp::GetUrlDomain(Endpoint.BaseUrl).Equals(Host, ESearchCase::IgnoreCase))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void FThirdwebEngineEndpoints::Refresh()
+{
+	const TArray<FString> BaseUrls = UThirdwebRuntimeSettings::GetEngineBaseUrls();
+	bool bChanged = BaseUrls.Num() != Endpoints.Num();
+	for (int32 i = 0; !bChanged && i < BaseUrls.Num(); i++)
+	{
+		bChanged = !Endpoints[i].BaseUrl.Equals(BaseUrls[i]);
+	}
+	if (!bChanged)
+	{
+		return;
+	}
+
+	TArray<FEndpoint> Previous = MoveTemp(Endpoints);
+	Endpoints.Reset(BaseUrls.Num());
+	for (const FString& BaseUrl : BaseUrls)
+	{
+		const FEndpoint* Existing = Previous.FindByPredicate([&BaseUrl](const FEndpoint& Endpoint) { return Endpoint.BaseUrl.Equals(BaseUrl); });
+		FEndpoint& Endpoint = Endpoints.Add_GetRef(Existing ? *Existing : FEndpoint());
+		Endpoint.BaseUrl = BaseUrl;
+	}
+}
+
+bool FThirdwebEngineEndpoints::IsCircuitAccepting(const FEndpoint& Endpoint, const double Now)
+{
+	return Endpoint.OpenUntil <= 0.0 || (Now >= Endpoint.OpenUntil && !Endpoint.bProbing);
+}
+
+FThirdwebEngineEndpoints::FEndpoint* FThirdwebEngineEndpoints::Find(const FString& BaseUrl)
+{
+	return Endpoints.FindByPredicate([&BaseUrl](const FEndpoint& Endpoint) { return Endpoint.BaseUrl.Equals(BaseUrl); });
+}
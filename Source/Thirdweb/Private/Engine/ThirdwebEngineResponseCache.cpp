@@ -0,0 +1,128 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/ThirdwebEngineResponseCache.h"
+
+#include "ThirdwebRuntimeSettings.h"
+#include "Misc/ScopeLock.h"
+
+float FThirdwebEngineResponseCache::GetTTL(const FString& Url)
+{
+	FString Path = Url;
+	if (int32 QueryIndex; Path.FindChar(TEXT('?'), QueryIndex))
+	{
+		Path.LeftInline(QueryIndex);
+	}
+	int32 SlashIndex;
+	const FString Endpoint = Path.FindLastChar(TEXT('/'), SlashIndex) ? Path.RightChop(SlashIndex + 1) : Path;
+	return UThirdwebRuntimeSettings::GetEngineCacheTTL(Endpoint);
+}
+
+FThirdwebEngineResponseCache::ELookup FThirdwebEngineResponseCache::Find(const FString& Url, FHttpResponsePtr& OutResponse, bool& bOutShouldRevalidate)
+{
+	bOutShouldRevalidate = false;
+	const double Now = FPlatformTime::Seconds();
+
+	FScopeLock ScopeLock(&Lock);
+	FEntry* Entry = Entries.Find(Url);
+	if (!Entry)
+	{
+		Stats.Misses++;
+		return ELookup::Miss;
+	}
+
+	ELookup Result = ELookup::Fresh;
+	if (Now > Entry->ExpiresAt)
+	{
+		if (Now > Entry->ExpiresAt + UThirdwebRuntimeSettings::GetEngineCacheStaleWhileRevalidate())
+		{
+			TArray<FHttpResponsePtr> Unused;
+			Remove(Url, Unused);
+			Stats.Misses++;
+			return ELookup::Miss;
+		}
+		Result = ELookup::Stale;
+		bOutShouldRevalidate = !Entry->bRevalidating;
+		Entry->bRevalidating = true;
+		Stats.StaleHits++;
+	}
+	else
+	{
+		Stats.Hits++;
+	}
+
+	Lru.RemoveNode(Entry->LruNode, false);
+	Lru.AddHead(Entry->LruNode);
+	OutResponse = Entry->Response;
+	return Result;
+}
+
+bool FThirdwebEngineResponseCache::Put(const FString& Url, const FHttpResponsePtr& Response, const float TTL, TArray<FHttpResponsePtr>& OutRemoved)
+{
+	if (!Response.IsValid() || TTL <= 0.0f)
+	{
+		return false;
+	}
+	const int64 MaxBytes = UThirdwebRuntimeSettings::GetEngineCacheMaxMemory();
+	// Payload plus key. The decoded JSON is shared with callers and not accounted for
+	const int64 Bytes = Response->GetContent().Num() + Url.GetAllocatedSize();
+	if (Bytes > MaxBytes)
+	{
+		return false;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	Remove(Url, OutRemoved);
+	while (Stats.Bytes + Bytes > MaxBytes && Lru.GetTail())
+	{
+		const FString Oldest = Lru.GetTail()->GetValue();
+		Remove(Oldest, OutRemoved);
+		Stats.Evictions++;
+	}
+
+	Lru.AddHead(Url);
+	FEntry& Entry = Entries.Add(Url);
+	Entry.Response = Response;
+	Entry.ExpiresAt = FPlatformTime::Seconds() + TTL;
+	Entry.Bytes = Bytes;
+	Entry.LruNode = Lru.GetHead();
+	Stats.Bytes += Bytes;
+	Stats.Entries = Entries.Num();
+	return true;
+}
+
+void FThirdwebEngineResponseCache::Invalidate(const FString& ContractAddress, TArray<FHttpResponsePtr>& OutRemoved)
+{
+	const FString Segment = FString::Printf(TEXT("/%s/"), *ContractAddress);
+
+	FScopeLock ScopeLock(&Lock);
+	TArray<FString> Urls;
+	for (const TPair<FString, FEntry>& Pair : Entries)
+	{
+		if (ContractAddress.IsEmpty() || Pair.Key.Contains(Segment, ESearchCase::IgnoreCase))
+		{
+			Urls.Emplace(Pair.Key);
+		}
+	}
+	for (const FString& Url : Urls)
+	{
+		Remove(Url, OutRemoved);
+	}
+}
+
+FThirdwebEngineResponseCache::FStats FThirdwebEngineResponseCache::GetStats() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Stats;
+}
+
+void FThirdwebEngineResponseCache::Remove(const FString& Url, TArray<FHttpResponsePtr>& OutRemoved)
+{
+	FEntry Entry;
+	if (Entries.RemoveAndCopyValue(Url, Entry))
+	{
+		Lru.RemoveNode(Entry.LruNode);
+		Stats.Bytes -= Entry.Bytes;
+		Stats.Entries = Entries.Num();
+		OutRemoved.Emplace(Entry.Response);
+	}
+}
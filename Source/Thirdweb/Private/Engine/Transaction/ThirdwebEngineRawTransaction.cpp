@@ -0,0 +1,14 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/Transaction/ThirdwebEngineRawTransaction.h"
+
+#include "Dom/JsonObject.h"
+
+TSharedPtr<FJsonObject> FThirdwebEngineRawTransaction::ToJson() const
+{
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetStringField(TEXT("toAddress"), ToAddress);
+	JsonObject->SetStringField(TEXT("data"), Data);
+	JsonObject->SetStringField(TEXT("value"), Value.IsEmpty() ? TEXT("0") : Value);
+	return JsonObject;
+}
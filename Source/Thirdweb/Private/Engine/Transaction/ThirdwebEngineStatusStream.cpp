@@ -0,0 +1,147 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/Transaction/ThirdwebEngineStatusStream.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "ThirdwebUtils.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Transaction/ThirdwebEngineTransactionStatusResult.h"
+#include "IWebSocket.h"
+#include "WebSocketsModule.h"
+
+FThirdwebEngineStatusStream::FThirdwebEngineStatusStream(const FStatusDelegate& InStatusDelegate, const FDisconnectedDelegate& InDisconnectedDelegate)
+	: StatusDelegate(InStatusDelegate), DisconnectedDelegate(InDisconnectedDelegate)
+{
+}
+
+FThirdwebEngineStatusStream::~FThirdwebEngineStatusStream()
+{
+	for (TPair<FString, FSocket>& Pair : Sockets)
+	{
+		Close(Pair.Value);
+	}
+}
+
+bool FThirdwebEngineStatusStream::Subscribe(const FString& QueueId)
+{
+	if (Sockets.Contains(QueueId))
+	{
+		return true;
+	}
+	if (!UThirdwebRuntimeSettings::IsEngineTransactionStreamingEnabled() || Sockets.Num() >= UThirdwebRuntimeSettings::GetEngineTransactionMaxStreams())
+	{
+		return false;
+	}
+	const FString Url = MakeUrl(QueueId);
+	if (Url.IsEmpty())
+	{
+		return false;
+	}
+
+	TMap<FString, FString> Headers;
+	Headers.Add(TEXT("authorization"), TEXT("Bearer ") + UThirdwebRuntimeSettings::GetEngineAccessToken());
+	const TSharedRef<IWebSocket> Socket = FWebSocketsModule::Get().CreateWebSocket(Url, TEXT(""), Headers);
+
+	// Every callback is unbound before the socket is closed or the stream destroyed, so capturing this is safe
+	Socket->OnConnected().AddLambda([this, QueueId]()
+	{
+		if (FSocket* Entry = Sockets.Find(QueueId))
+		{
+			TW_LOG(Verbose, TEXT("FThirdwebEngineStatusStream::OnConnected::%s"), *QueueId)
+			Entry->bConnected = true;
+		}
+	});
+	Socket->OnMessage().AddLambda([this, QueueId](const FString& Message)
+	{
+		if (FThirdwebEngineTransactionStatusResult Result; ParseMessage(Message, Result))
+		{
+			EXECUTE_IF_BOUND(StatusDelegate, QueueId, Result)
+		}
+		else
+		{
+			TW_LOG(Warning, TEXT("FThirdwebEngineStatusStream::OnMessage::%s::Unreadable message::%s"), *QueueId, *Message)
+		}
+	});
+	Socket->OnConnectionError().AddLambda([this, QueueId](const FString& Error) { OnClosed(QueueId, Error); });
+	Socket->OnClosed().AddLambda([this, QueueId](int32 StatusCode, const FString& Reason, bool bWasClean) { OnClosed(QueueId, Reason); });
+
+	Sockets.Add(QueueId, {Socket, false});
+	Socket->Connect();
+	return true;
+}
+
+void FThirdwebEngineStatusStream::Unsubscribe(const FString& QueueId)
+{
+	if (FSocket Socket; Sockets.RemoveAndCopyValue(QueueId, Socket))
+	{
+		Close(Socket);
+	}
+}
+
+bool FThirdwebEngineStatusStream::IsConnected(const FString& QueueId) const
+{
+	const FSocket* Socket = Sockets.Find(QueueId);
+	return Socket && Socket->bConnected;
+}
+
+FString FThirdwebEngineStatusStream::MakeUrl(const FString& QueueId)
+{
+	FString Base = UThirdwebRuntimeSettings::GetEngineTransactionStreamBaseUrl();
+	if (Base.IsEmpty())
+	{
+		Base = UThirdwebRuntimeSettings::GetEngineBaseUrl();
+		if (Base.StartsWith(TEXT("https://")))
+		{
+			Base = TEXT("wss://") + Base.RightChop(8);
+		}
+		else if (Base.StartsWith(TEXT("http://")))
+		{
+			Base = TEXT("ws://") + Base.RightChop(7);
+		}
+	}
+	return Base.IsEmpty() ? TEXT("") : FString::Printf(TEXT("%s/transaction/status/%s"), *Base, *QueueId);
+}
+
+bool FThirdwebEngineStatusStream::ParseMessage(const FString& Message, FThirdwebEngineTransactionStatusResult& Result)
+{
+	TSharedPtr<FJsonObject> JsonObject = ThirdwebUtils::Json::ToJson(Message);
+	if (JsonObject->HasTypedField<EJson::Object>(TEXT("result")))
+	{
+		JsonObject = JsonObject->GetObjectField(TEXT("result"));
+	}
+	if (!JsonObject->HasTypedField<EJson::String>(TEXT("status")))
+	{
+		return false;
+	}
+	Result = FThirdwebEngineTransactionStatusResult::FromJson(JsonObject);
+	return true;
+}
+
+void FThirdwebEngineStatusStream::OnClosed(const FString& QueueId, const FString& Reason)
+{
+	if (FSocket Socket; Sockets.RemoveAndCopyValue(QueueId, Socket))
+	{
+		TW_LOG(Verbose, TEXT("FThirdwebEngineStatusStream::OnClosed::%s::%s"), *QueueId, *Reason)
+		Close(Socket);
+		EXECUTE_IF_BOUND(DisconnectedDelegate, QueueId)
+	}
+}
+
+void FThirdwebEngineStatusStream::Close(FSocket& Socket)
+{
+	if (Socket.Socket.IsValid())
+	{
+		Socket.Socket->OnConnected().Clear();
+		Socket.Socket->OnMessage().Clear();
+		Socket.Socket->OnConnectionError().Clear();
+		Socket.Socket->OnClosed().Clear();
+		if (Socket.Socket->IsConnected())
+		{
+			Socket.Socket->Close();
+		}
+		// This may run inside a callback of the socket itself, so it is only released on the next tick
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([Released = MoveTemp(Socket.Socket)](float) { return false; }));
+	}
+}
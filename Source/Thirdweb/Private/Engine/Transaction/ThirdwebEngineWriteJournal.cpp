@@ -0,0 +1,236 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/Transaction/ThirdwebEngineWriteJournal.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "ThirdwebUtils.h"
+#include "Dom/JsonObject.h"
+#include "Engine/ThirdwebEngineClient.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+FThirdwebEngineWriteJournal& FThirdwebEngineWriteJournal::Get()
+{
+	static FThirdwebEngineWriteJournal Journal(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Thirdweb"), TEXT("Engine"), TEXT("WriteJournal.jsonl")));
+	return Journal;
+}
+
+bool FThirdwebEngineWriteJournal::IsEnabled()
+{
+	return UThirdwebRuntimeSettings::IsEngineWriteJournalEnabled();
+}
+
+FThirdwebEngineWriteJournal::FThirdwebEngineWriteJournal(const FString& InPath) : Path(InPath)
+{
+}
+
+FThirdwebEngineWriteJournal::~FThirdwebEngineWriteJournal()
+{
+	Handle.Reset();
+}
+
+void FThirdwebEngineWriteJournal::Append(const FString& IdempotencyKey, const FString& Url, const TMap<FString, FString>& Headers, const FString& Body)
+{
+	if (IdempotencyKey.IsEmpty())
+	{
+		return;
+	}
+	const TSharedPtr<FJsonObject> JsonHeaders = MakeShareable(new FJsonObject);
+	for (const TPair<FString, FString>& Header : Headers)
+	{
+		if (Header.Key.StartsWith(TEXT("x-")) && !Header.Value.IsEmpty())
+		{
+			JsonHeaders->SetStringField(Header.Key, Header.Value);
+		}
+	}
+	const TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetStringField(TEXT("key"), IdempotencyKey);
+	JsonObject->SetStringField(TEXT("url"), Url);
+	JsonObject->SetObjectField(TEXT("headers"), JsonHeaders);
+	JsonObject->SetStringField(TEXT("body"), Body);
+	const FString Line = ThirdwebUtils::Json::ToString(JsonObject);
+
+	FScopeLock ScopeLock(&Lock);
+	Open();
+	Pending.Add(IdempotencyKey, Line);
+	WriteLine(Line);
+}
+
+void FThirdwebEngineWriteJournal::Acknowledge(const FString& IdempotencyKey, const FString& QueueId)
+{
+	Answer(IdempotencyKey, TEXT("queueId"), QueueId);
+}
+
+void FThirdwebEngineWriteJournal::Reject(const FString& IdempotencyKey, const FString& Error)
+{
+	Answer(IdempotencyKey, TEXT("error"), Error);
+}
+
+bool FThirdwebEngineWriteJournal::IsRefused(const FHttpResponsePtr& Response)
+{
+	if (!Response.IsValid())
+	{
+		return false;
+	}
+	const int32 Code = Response->GetResponseCode();
+	return Code >= 400 && Code < 500 && Code != EHttpResponseCodes::RequestTimeout && Code != EHttpResponseCodes::TooManyRequests;
+}
+
+int32 FThirdwebEngineWriteJournal::Replay(const FReplayDelegate& Delegate)
+{
+	TArray<FString> Lines;
+	{
+		FScopeLock ScopeLock(&Lock);
+		Open();
+		Pending.GenerateValueArray(Lines);
+	}
+	for (const FString& Line : Lines)
+	{
+		const TSharedPtr<FJsonObject> JsonObject = ThirdwebUtils::Json::ToJson(Line);
+		const FString Key = JsonObject->GetStringField(TEXT("key"));
+		TW_LOG(Display, TEXT("FThirdwebEngineWriteJournal::Replay::%s"), *Key)
+
+		const TSharedRef<IHttpRequest> Request = ThirdwebUtils::Internal::CreateEngineRequest(TEXT("POST"));
+		Request->SetURL(JsonObject->GetStringField(TEXT("url")));
+		if (const TSharedPtr<FJsonObject>* JsonHeaders; JsonObject->TryGetObjectField(TEXT("headers"), JsonHeaders))
+		{
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Header : (*JsonHeaders)->Values)
+			{
+				Request->SetHeader(Header.Key, Header.Value->AsString());
+			}
+		}
+		Request->SetContentAsString(JsonObject->GetStringField(TEXT("body")));
+		Request->OnProcessRequestComplete().BindLambda([this, Key, Delegate](HTTP_LAMBDA_PARAMS)
+		{
+			if (!bConnectedSuccessfully)
+			{
+				TW_LOG(Warning, TEXT("FThirdwebEngineWriteJournal::Replay::%s::Network Connection Failed"), *Key)
+				EXECUTE_IF_BOUND(Delegate, Key, TEXT(""), TEXT("Network Connection Failed"))
+				return;
+			}
+			FString Error;
+			if (TSharedPtr<FJsonObject> JsonObject; ThirdwebUtils::Json::ParseEngineResponse(Response->GetContentAsString(), JsonObject, Error))
+			{
+				const FString QueueId = JsonObject->HasTypedField<EJson::String>(TEXT("queueId")) ? JsonObject->GetStringField(TEXT("queueId")) : TEXT("Unknown");
+				Acknowledge(Key, QueueId);
+				TW_LOG(Display, TEXT("FThirdwebEngineWriteJournal::Replay::%s::QueueId=%s"), *Key, *QueueId)
+				EXECUTE_IF_BOUND(Delegate, Key, QueueId, TEXT(""))
+			}
+			else
+			{
+				if (IsRefused(Response))
+				{
+					Reject(Key, Error);
+				}
+				TW_LOG(Warning, TEXT("FThirdwebEngineWriteJournal::Replay::%s::%s"), *Key, *Error)
+				EXECUTE_IF_BOUND(Delegate, Key, TEXT(""), Error)
+			}
+		});
+		FThirdwebEngineClient::Get().ProcessRequest(Request);
+	}
+	return Lines.Num();
+}
+
+int32 FThirdwebEngineWriteJournal::GetPendingCount() const
+{
+	FScopeLock ScopeLock(&Lock);
+	return Pending.Num();
+}
+
+void FThirdwebEngineWriteJournal::Open()
+{
+	if (bOpened)
+	{
+		return;
+	}
+	bOpened = true;
+
+	if (TArray<FString> Lines; FFileHelper::LoadFileToStringArray(Lines, *Path))
+	{
+		for (const FString& Line : Lines)
+		{
+			const TSharedPtr<FJsonObject> JsonObject = ThirdwebUtils::Json::ToJson(Line);
+			FString Key;
+			if (!JsonObject->TryGetStringField(TEXT("key"), Key))
+			{
+				// Most likely the last line, cut short by the crash
+				continue;
+			}
+			if (JsonObject->HasField(TEXT("queueId")) || JsonObject->HasField(TEXT("error")))
+			{
+				Pending.Remove(Key);
+			}
+			else
+			{
+				Pending.Add(Key, Line);
+			}
+		}
+		TW_LOG(Verbose, TEXT("FThirdwebEngineWriteJournal::Open::%s::Entries=%d::Pending=%d"), *Path, Lines.Num(), Pending.Num())
+	}
+
+	// The pending writes replace the old journal in one move, so a crash while compacting leaves either of them in place
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+	TArray<FString> PendingLines;
+	Pending.GenerateValueArray(PendingLines);
+	if (const FString TempPath = Path + TEXT(".tmp"); FFileHelper::SaveStringArrayToFile(PendingLines, *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		IFileManager::Get().Move(*Path, *TempPath, true);
+	}
+	Handle.Reset(PlatformFile.OpenWrite(*Path, true, false));
+	if (!Handle)
+	{
+		TW_LOG(Error, TEXT("FThirdwebEngineWriteJournal::Open::Could not open %s, writes are not journaled"), *Path)
+		return;
+	}
+	Size = Handle->Size();
+}
+
+void FThirdwebEngineWriteJournal::WriteLine(const FString& Line)
+{
+	if (!Handle)
+	{
+		return;
+	}
+	const FTCHARToUTF8 Converted(*(Line + TEXT("\n")));
+	Handle->Write(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	Handle->Flush();
+	Size += Converted.Length();
+}
+
+void FThirdwebEngineWriteJournal::Answer(const FString& IdempotencyKey, const FString& Field, const FString& Value)
+{
+	if (IdempotencyKey.IsEmpty())
+	{
+		return;
+	}
+	const TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetStringField(TEXT("key"), IdempotencyKey);
+	JsonObject->SetStringField(Field, Value);
+	const FString Line = ThirdwebUtils::Json::ToString(JsonObject);
+
+	FScopeLock ScopeLock(&Lock);
+	Open();
+	if (Pending.Remove(IdempotencyKey) == 0)
+	{
+		return;
+	}
+	if (Pending.Num() == 0 && Size >= CompactThreshold)
+	{
+		// Nothing left to replay, so the whole journal can go. The old handle is closed first, as it does not share the file
+		Handle.Reset();
+		Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*Path, false, false));
+		Size = 0;
+		if (!Handle)
+		{
+			TW_LOG(Error, TEXT("FThirdwebEngineWriteJournal::Answer::Could not reopen %s, writes are not journaled"), *Path)
+		}
+		return;
+	}
+	WriteLine(Line);
+}
@@ -6,6 +6,7 @@
 #include "ThirdwebRuntimeSettings.h"
 #include "ThirdwebUtils.h"
 #include "Engine/ThirdwebEngine.h"
+#include "Engine/ThirdwebEngineClient.h"
 #include "Engine/Transaction/ThirdwebEngineTransactionReceipt.h"
 #include "Engine/Transaction/ThirdwebEngineTransactionStatusResult.h"
 #include "Interfaces/IHttpRequest.h"
@@ -32,19 +33,14 @@ namespace ThirdwebEngine::Transaction
 			Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 			{
 				CHECK_NETWORK
-				FString Content = Response->GetContentAsString();
-				TW_LOG(Verbose, TEXT("ThirdwebEngine::Transaction::GetStatus::Content=%s"), *Content)
-				FString Error;
-				if (TSharedPtr<FJsonObject> JsonObject; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonObject, Error))
-				{
-					EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebEngineTransactionStatusResult::FromJson(JsonObject))
-				}
-				else
-				{
-					EXECUTE_IF_BOUND(ErrorDelegate, Error)
-				}
+				ThirdwebEngine::ParseResponseAsync<TSharedPtr<FJsonObject>>(
+					Response,
+					[](const TSharedPtr<FJsonObject>& JsonObject) { return FThirdwebEngineTransactionStatusResult::FromJson(JsonObject); },
+					SuccessDelegate,
+					ErrorDelegate
+				);
 			});
-			Request->ProcessRequest();
+			FThirdwebEngineClient::Get().ProcessRequest(Request);
 		}
 
 		void GetReceipt(const UObject* Outer, const FString& TxHash, const int64 ChainId, const FGetTransactionReceiptDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
@@ -55,18 +51,13 @@ namespace ThirdwebEngine::Transaction
 			Request->OnProcessRequestComplete().BindWeakLambda(Outer, [SuccessDelegate, ErrorDelegate](HTTP_LAMBDA_PARAMS)
 			{
 				CHECK_NETWORK
-				FString Content = Response->GetContentAsString();
-				TW_LOG(Verbose, TEXT("ThirdwebEngine::Transaction::GetReceipt::Content=%s"), *Content)
-				FString Error;
-				if (TSharedPtr<FJsonObject> JsonObject; ThirdwebUtils::Json::ParseEngineResponse(Content, JsonObject, Error))
-				{
-					EXECUTE_IF_BOUND(SuccessDelegate, FThirdwebEngineTransactionReceipt::FromJson(JsonObject))
-				}
-				else
-				{
-					EXECUTE_IF_BOUND(ErrorDelegate, Error)
-				}
+				ThirdwebEngine::ParseResponseAsync<TSharedPtr<FJsonObject>>(
+					Response,
+					[](const TSharedPtr<FJsonObject>& JsonObject) { return FThirdwebEngineTransactionReceipt::FromJson(JsonObject); },
+					SuccessDelegate,
+					ErrorDelegate
+				);
 			});
-			Request->ProcessRequest();
+			FThirdwebEngineClient::Get().ProcessRequest(Request);
 		}
 }
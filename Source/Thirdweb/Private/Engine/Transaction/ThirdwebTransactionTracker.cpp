@@ -0,0 +1,251 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Engine/Transaction/ThirdwebTransactionTracker.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Transaction/ThirdwebEngine_Transaction.h"
+#include "Kismet/GameplayStatics.h"
+
+void UThirdwebTransactionTracker::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	LastTickAt = FPlatformTime::Seconds();
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UThirdwebTransactionTracker::Tick), 0.1f);
+	Stream = MakeUnique<FThirdwebEngineStatusStream>(
+		FThirdwebEngineStatusStream::FStatusDelegate::CreateUObject(this, &UThirdwebTransactionTracker::OnStreamStatus),
+		FThirdwebEngineStatusStream::FDisconnectedDelegate::CreateUObject(this, &UThirdwebTransactionTracker::OnStreamDisconnected)
+	);
+}
+
+void UThirdwebTransactionTracker::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	Stream.Reset();
+	// Waiters such as the backend wallet pool hold on to their transactions until told they are gone
+	const TMap<FString, FTrackedTransaction> Abandoned = MoveTemp(Tracked);
+	Tracked.Reset();
+	for (const TPair<FString, FTrackedTransaction>& Pair : Abandoned)
+	{
+		for (const FStringDelegate& Delegate : Pair.Value.ErrorDelegates)
+		{
+			EXECUTE_IF_BOUND(Delegate, TEXT("Tracker shut down"))
+		}
+	}
+	Super::Deinitialize();
+}
+
+void UThirdwebTransactionTracker::Track(const FString& QueueId, const FStatusDelegate& StatusDelegate, const FStringDelegate& ErrorDelegate)
+{
+	if (QueueId.IsEmpty())
+	{
+		return;
+	}
+	FTrackedTransaction* Transaction = Tracked.Find(QueueId);
+	if (!Transaction)
+	{
+		Transaction = &Tracked.Add(QueueId);
+		Transaction->Interval = UThirdwebRuntimeSettings::GetEngineTransactionPollInterval();
+		Transaction->NextPollAt = FPlatformTime::Seconds() + Transaction->Interval;
+		TW_LOG(Verbose, TEXT("UThirdwebTransactionTracker::Track::%s::Tracked=%d"), *QueueId, Tracked.Num())
+		if (Stream)
+		{
+			Stream->Subscribe(QueueId);
+		}
+	}
+	if (StatusDelegate.IsBound())
+	{
+		Transaction->StatusDelegates.Add(StatusDelegate);
+	}
+	if (ErrorDelegate.IsBound())
+	{
+		Transaction->ErrorDelegates.Add(ErrorDelegate);
+	}
+}
+
+void UThirdwebTransactionTracker::TrackTransaction(const FString& QueueId)
+{
+	Track(QueueId, {}, {});
+}
+
+void UThirdwebTransactionTracker::Untrack(const FString& QueueId)
+{
+	Abandon(QueueId, TEXT("Untracked"));
+}
+
+UThirdwebTransactionTracker* UThirdwebTransactionTracker::Get(const UObject* WorldContextObject)
+{
+	if (UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject))
+	{
+		return GameInstance->GetSubsystem<UThirdwebTransactionTracker>();
+	}
+	return nullptr;
+}
+
+bool UThirdwebTransactionTracker::IsTerminal(const EThirdwebEngineTransactionStatus Status)
+{
+	return Status == EThirdwebEngineTransactionStatus::Mined || Status == EThirdwebEngineTransactionStatus::Errored || Status == EThirdwebEngineTransactionStatus::Cancelled;
+}
+
+bool UThirdwebTransactionTracker::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	const float Rate = UThirdwebRuntimeSettings::GetEngineTransactionPollRate();
+	// Unused budget carries over for at most a second, so a burst never exceeds one second worth of requests
+	Budget = FMath::Min<double>(FMath::Max(Rate, 1.0f), Budget + (Now - LastTickAt) * Rate);
+	LastTickAt = Now;
+
+	if (Tracked.Num() == 0 || (Rate > 0.0f && Budget < 1.0))
+	{
+		return true;
+	}
+
+	TArray<TPair<double, FString>> Due;
+	for (const TPair<FString, FTrackedTransaction>& Pair : Tracked)
+	{
+		if (!Pair.Value.bInFlight && Pair.Value.NextPollAt <= Now && !(Stream && Stream->IsConnected(Pair.Key)))
+		{
+			Due.Emplace(Pair.Value.NextPollAt, Pair.Key);
+		}
+	}
+	Due.Sort([](const TPair<double, FString>& A, const TPair<double, FString>& B) { return A.Key < B.Key; });
+
+	for (const TPair<double, FString>& Entry : Due)
+	{
+		if (Rate > 0.0f)
+		{
+			if (Budget < 1.0)
+			{
+				break;
+			}
+			Budget -= 1.0;
+		}
+		// A synchronous completion may have untracked an earlier entry
+		if (FTrackedTransaction* Transaction = Tracked.Find(Entry.Value))
+		{
+			Poll(Entry.Value, *Transaction);
+		}
+	}
+	return true;
+}
+
+void UThirdwebTransactionTracker::Poll(const FString& QueueId, FTrackedTransaction& Transaction)
+{
+	Transaction.bInFlight = true;
+	// Transaction may be gone once GetStatus returns if the response was served synchronously
+	ThirdwebEngine::Transaction::GetStatus(
+		this,
+		QueueId,
+		ThirdwebEngine::Transaction::FGetTransactionStatusDelegate::CreateUObject(this, &UThirdwebTransactionTracker::OnStatus, QueueId),
+		FStringDelegate::CreateUObject(this, &UThirdwebTransactionTracker::OnError, QueueId)
+	);
+}
+
+void UThirdwebTransactionTracker::OnStatus(const FThirdwebEngineTransactionStatusResult& Result, FString QueueId)
+{
+	FTrackedTransaction* Transaction = Tracked.Find(QueueId);
+	if (!Transaction)
+	{
+		return;
+	}
+	Transaction->bInFlight = false;
+	Transaction->Failures = 0;
+
+	const double Now = FPlatformTime::Seconds();
+	if (Result.Status == Transaction->Status)
+	{
+		// Queued and sent transactions are about to change, so only other states back off
+		if (Result.Status != EThirdwebEngineTransactionStatus::Queued && Result.Status != EThirdwebEngineTransactionStatus::Sent)
+		{
+			Transaction->Interval = FMath::Min(Transaction->Interval * 1.5f, UThirdwebRuntimeSettings::GetEngineTransactionMaxPollInterval());
+		}
+		Transaction->NextPollAt = Now + Transaction->Interval;
+		return;
+	}
+
+	TW_LOG(Verbose, TEXT("UThirdwebTransactionTracker::OnStatus::%s::%s"), *QueueId, *UEnum::GetValueAsString(Result.Status))
+	Transaction->Status = Result.Status;
+	Transaction->Interval = UThirdwebRuntimeSettings::GetEngineTransactionPollInterval();
+	Transaction->NextPollAt = Now + Transaction->Interval;
+
+	// Copy out first: delegates may track or untrack transactions
+	const TArray<FStatusDelegate> StatusDelegates = Transaction->StatusDelegates;
+	if (IsTerminal(Result.Status))
+	{
+		Remove(QueueId);
+	}
+	for (const FStatusDelegate& Delegate : StatusDelegates)
+	{
+		EXECUTE_IF_BOUND(Delegate, Result)
+	}
+	OnStatusChanged.Broadcast(QueueId, Result);
+}
+
+void UThirdwebTransactionTracker::OnError(const FString& Error, FString QueueId)
+{
+	FTrackedTransaction* Transaction = Tracked.Find(QueueId);
+	if (!Transaction)
+	{
+		return;
+	}
+	Transaction->bInFlight = false;
+	if (++Transaction->Failures < MaxFailures)
+	{
+		Transaction->Interval = FMath::Min(Transaction->Interval * 2.0f, UThirdwebRuntimeSettings::GetEngineTransactionMaxPollInterval());
+		Transaction->NextPollAt = FPlatformTime::Seconds() + Transaction->Interval;
+		return;
+	}
+
+	TW_LOG(Warning, TEXT("UThirdwebTransactionTracker::OnError::%s::Giving up after %d failures::%s"), *QueueId, MaxFailures, *Error)
+	Abandon(QueueId, Error);
+}
+
+void UThirdwebTransactionTracker::OnStreamStatus(const FString& QueueId, const FThirdwebEngineTransactionStatusResult& Result)
+{
+	// Handled like a poll result, which also pushes the next fallback poll back
+	OnStatus(Result, QueueId);
+}
+
+void UThirdwebTransactionTracker::OnStreamDisconnected(const FString& QueueId)
+{
+	if (FTrackedTransaction* Transaction = Tracked.Find(QueueId))
+	{
+		// Catch up on anything missed while the stream was going down
+		Transaction->Interval = UThirdwebRuntimeSettings::GetEngineTransactionPollInterval();
+		Transaction->NextPollAt = FPlatformTime::Seconds();
+	}
+}
+
+void UThirdwebTransactionTracker::Remove(const FString& QueueId)
+{
+	Tracked.Remove(QueueId);
+	if (Stream && Stream->IsSubscribed(QueueId))
+	{
+		Stream->Unsubscribe(QueueId);
+		// Hand the freed stream to a transaction that is still being polled
+		for (const TPair<FString, FTrackedTransaction>& Pair : Tracked)
+		{
+			if (!Stream->IsSubscribed(Pair.Key))
+			{
+				Stream->Subscribe(Pair.Key);
+				break;
+			}
+		}
+	}
+}
+
+void UThirdwebTransactionTracker::Abandon(const FString& QueueId, const FString& Error)
+{
+	const FTrackedTransaction* Transaction = Tracked.Find(QueueId);
+	if (!Transaction)
+	{
+		return;
+	}
+	const TArray<FStringDelegate> ErrorDelegates = Transaction->ErrorDelegates;
+	Remove(QueueId);
+	for (const FStringDelegate& Delegate : ErrorDelegates)
+	{
+		EXECUTE_IF_BOUND(Delegate, Error)
+	}
+}
@@ -0,0 +1,116 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Internal/ThirdwebFFIExecutor.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/ScopeRWLock.h"
+#include "Tasks/Task.h"
+
+namespace
+{
+	EQueuedWorkPriority ToQueuedWorkPriority(const EThirdwebFFIPriority Priority)
+	{
+		switch (Priority)
+		{
+		case EThirdwebFFIPriority::Interactive: return EQueuedWorkPriority::High;
+		case EThirdwebFFIPriority::Background: return EQueuedWorkPriority::Low;
+		default: return EQueuedWorkPriority::Normal;
+		}
+	}
+}
+
+std::atomic<FThirdwebFFIExecutor*> FThirdwebFFIExecutor::Instance{nullptr};
+
+FThirdwebFFIExecutor& FThirdwebFFIExecutor::Get()
+{
+	static FThirdwebFFIExecutor Executor;
+	return Executor;
+}
+
+FThirdwebFFIExecutor::FThirdwebFFIExecutor()
+{
+	const int32 ThreadCount = UThirdwebRuntimeSettings::GetWalletThreadCount();
+	if (FPlatformProcess::SupportsMultithreading())
+	{
+		Pool = FQueuedThreadPool::Allocate();
+		// The threads mostly wait on the network, so a small stack and normal priority are plenty
+		if (!Pool->Create(ThreadCount, 128 * 1024, TPri_Normal, TEXT("ThirdwebWalletPool")))
+		{
+			delete Pool;
+			Pool = nullptr;
+		}
+	}
+	TW_LOG(Verbose, TEXT("FThirdwebFFIExecutor::Threads=%d"), Pool ? ThreadCount : 0)
+	Instance.store(this);
+}
+
+void FThirdwebFFIExecutor::Shutdown()
+{
+	FQueuedThreadPool* ShutdownPool;
+	{
+		FWriteScopeLock WriteLock(Lock);
+		if (bShutdown)
+		{
+			return;
+		}
+		bShutdown = true;
+		ShutdownPool = Pool;
+		Pool = nullptr;
+	}
+	TW_LOG(Verbose, TEXT("FThirdwebFFIExecutor::Shutdown::Active=%d::Queued=%d"), Active.load(), Queued.load())
+	if (ShutdownPool)
+	{
+		ShutdownPool->Destroy();
+		delete ShutdownPool;
+	}
+}
+
+void FThirdwebFFIExecutor::ShutdownIfCreated()
+{
+	if (FThirdwebFFIExecutor* Executor = Instance.load())
+	{
+		Executor->Shutdown();
+	}
+}
+
+void FThirdwebFFIExecutor::Execute(const EThirdwebFFIPriority Priority, TUniqueFunction<void()>&& Function)
+{
+	FWork* Work = new FWork(*this, Priority, MoveTemp(Function));
+	++Queued;
+	++QueuedByPriority[static_cast<int32>(Priority)];
+	FReadScopeLock ReadLock(Lock);
+	if (bShutdown)
+	{
+		TW_LOG(Warning, TEXT("FThirdwebFFIExecutor::Execute::Dropping call queued after shutdown"))
+		Work->Abandon();
+	}
+	else if (Pool)
+	{
+		Pool->AddQueuedWork(Work, ToQueuedWorkPriority(Priority));
+	}
+	else
+	{
+		// Without threads of its own the call can only go to the task graph
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, [Work] { Work->DoThreadedWork(); });
+	}
+}
+
+void FThirdwebFFIExecutor::FWork::DoThreadedWork()
+{
+	--Executor.Queued;
+	--Executor.QueuedByPriority[static_cast<int32>(Priority)];
+	++Executor.Active;
+	Function();
+	--Executor.Active;
+	++Executor.Completed;
+	delete this;
+}
+
+void FThirdwebFFIExecutor::FWork::Abandon()
+{
+	--Executor.Queued;
+	--Executor.QueuedByPriority[static_cast<int32>(Priority)];
+	delete this;
+}
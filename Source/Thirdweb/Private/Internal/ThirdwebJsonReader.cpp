@@ -0,0 +1,492 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Internal/ThirdwebJsonReader.h"
+
+#include "Containers/StringConv.h"
+
+namespace ThirdwebJsonReader
+{
+	// Guards Skip and nested reads against stack exhaustion on hostile input
+	static constexpr int32 MaxDepth = 256;
+
+	static bool IsDigit(const UTF8CHAR Char)
+	{
+		return Char >= '0' && Char <= '9';
+	}
+
+	static int32 HexValue(const UTF8CHAR Char)
+	{
+		if (Char >= '0' && Char <= '9') return Char - '0';
+		if (Char >= 'a' && Char <= 'f') return Char - 'a' + 10;
+		if (Char >= 'A' && Char <= 'F') return Char - 'A' + 10;
+		return -1;
+	}
+
+	static void AppendCodepoint(TArray<UTF8CHAR>& Out, const uint32 Codepoint)
+	{
+		if (Codepoint < 0x80)
+		{
+			Out.Add(static_cast<UTF8CHAR>(Codepoint));
+		}
+		else if (Codepoint < 0x800)
+		{
+			Out.Add(static_cast<UTF8CHAR>(0xC0 | (Codepoint >> 6)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | (Codepoint & 0x3F)));
+		}
+		else if (Codepoint < 0x10000)
+		{
+			Out.Add(static_cast<UTF8CHAR>(0xE0 | (Codepoint >> 12)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | ((Codepoint >> 6) & 0x3F)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | (Codepoint & 0x3F)));
+		}
+		else
+		{
+			Out.Add(static_cast<UTF8CHAR>(0xF0 | (Codepoint >> 18)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | ((Codepoint >> 12) & 0x3F)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | ((Codepoint >> 6) & 0x3F)));
+			Out.Add(static_cast<UTF8CHAR>(0x80 | (Codepoint & 0x3F)));
+		}
+	}
+
+	static FString ToString(const UTF8CHAR* Chars, const int32 Len)
+	{
+		if (Len == 0)
+		{
+			return FString();
+		}
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Chars), Len);
+		return FString(Converted.Length(), Converted.Get());
+	}
+}
+
+FThirdwebJsonReader::FThirdwebJsonReader(const TConstArrayView<uint8> InBytes)
+	: Data(reinterpret_cast<const UTF8CHAR*>(InBytes.GetData()))
+	, Num(InBytes.Num())
+{
+	// Skip a UTF-8 byte order mark
+	if (Num >= 3 && InBytes[0] == 0xEF && InBytes[1] == 0xBB && InBytes[2] == 0xBF)
+	{
+		Offset = 3;
+	}
+}
+
+EJson FThirdwebJsonReader::Peek()
+{
+	if (HasError())
+	{
+		return EJson::None;
+	}
+	SkipWhitespace();
+	if (Offset >= Num)
+	{
+		return EJson::None;
+	}
+	switch (Data[Offset])
+	{
+	case '{': return EJson::Object;
+	case '[': return EJson::Array;
+	case '"': return EJson::String;
+	case 't':
+	case 'f': return EJson::Boolean;
+	case 'n': return EJson::Null;
+	case '-': return EJson::Number;
+	default: return ThirdwebJsonReader::IsDigit(Data[Offset]) ? EJson::Number : EJson::None;
+	}
+}
+
+bool FThirdwebJsonReader::ReadObject(TFunctionRef<void(const FUtf8StringView Key)> OnField)
+{
+	if (Peek() != EJson::Object)
+	{
+		Skip();
+		return false;
+	}
+	if (++Depth > ThirdwebJsonReader::MaxDepth)
+	{
+		SetError(TEXT("Maximum depth exceeded"));
+		return false;
+	}
+	Offset++;
+
+	SkipWhitespace();
+	if (Consume('}'))
+	{
+		Depth--;
+		return true;
+	}
+	TArray<UTF8CHAR> UnescapedKey;
+	while (!HasError())
+	{
+		SkipWhitespace();
+		FUtf8StringView Key;
+		bool bEscaped;
+		if (!ReadStringToken(Key, bEscaped))
+		{
+			break;
+		}
+		if (bEscaped)
+		{
+			if (!Unescape(Key, UnescapedKey))
+			{
+				break;
+			}
+			Key = FUtf8StringView(UnescapedKey.GetData(), UnescapedKey.Num());
+		}
+		SkipWhitespace();
+		if (!Consume(':'))
+		{
+			SetError(TEXT("Expected ':'"));
+			break;
+		}
+
+		const int32 ValueOffset = Offset;
+		OnField(Key);
+		if (Offset == ValueOffset)
+		{
+			Skip();
+		}
+
+		SkipWhitespace();
+		if (Consume(','))
+		{
+			continue;
+		}
+		if (Consume('}'))
+		{
+			Depth--;
+			return true;
+		}
+		SetError(TEXT("Expected ',' or '}'"));
+	}
+	return false;
+}
+
+bool FThirdwebJsonReader::ReadArray(TFunctionRef<void()> OnElement)
+{
+	if (Peek() != EJson::Array)
+	{
+		Skip();
+		return false;
+	}
+	if (++Depth > ThirdwebJsonReader::MaxDepth)
+	{
+		SetError(TEXT("Maximum depth exceeded"));
+		return false;
+	}
+	Offset++;
+
+	SkipWhitespace();
+	if (Consume(']'))
+	{
+		Depth--;
+		return true;
+	}
+	while (!HasError())
+	{
+		SkipWhitespace();
+		const int32 ElementOffset = Offset;
+		OnElement();
+		if (Offset == ElementOffset)
+		{
+			Skip();
+		}
+
+		SkipWhitespace();
+		if (Consume(','))
+		{
+			continue;
+		}
+		if (Consume(']'))
+		{
+			Depth--;
+			return true;
+		}
+		SetError(TEXT("Expected ',' or ']'"));
+	}
+	return false;
+}
+
+bool FThirdwebJsonReader::Read(FString& Out)
+{
+	if (Peek() != EJson::String)
+	{
+		Skip();
+		return false;
+	}
+	FUtf8StringView Raw;
+	bool bEscaped;
+	if (!ReadStringToken(Raw, bEscaped))
+	{
+		return false;
+	}
+	if (!bEscaped)
+	{
+		Out = ThirdwebJsonReader::ToString(Raw.GetData(), Raw.Len());
+		return true;
+	}
+	TArray<UTF8CHAR> Unescaped;
+	if (!Unescape(Raw, Unescaped))
+	{
+		return false;
+	}
+	Out = ThirdwebJsonReader::ToString(Unescaped.GetData(), Unescaped.Num());
+	return true;
+}
+
+bool FThirdwebJsonReader::Read(bool& Out)
+{
+	if (Peek() != EJson::Boolean)
+	{
+		Skip();
+		return false;
+	}
+	const bool bValue = Data[Offset] == 't';
+	if (ReadLiteral(bValue ? "true" : "false"))
+	{
+		Out = bValue;
+		return true;
+	}
+	return false;
+}
+
+bool FThirdwebJsonReader::Read(double& Out)
+{
+	if (Peek() != EJson::Number)
+	{
+		Skip();
+		return false;
+	}
+	FUtf8StringView Token;
+	if (!ReadNumberToken(Token))
+	{
+		return false;
+	}
+	ANSICHAR Buffer[64];
+	if (Token.Len() >= UE_ARRAY_COUNT(Buffer))
+	{
+		Out = FCString::Atod(*ThirdwebJsonReader::ToString(Token.GetData(), Token.Len()));
+		return true;
+	}
+	FMemory::Memcpy(Buffer, Token.GetData(), Token.Len());
+	Buffer[Token.Len()] = '\0';
+	Out = FCStringAnsi::Atod(Buffer);
+	return true;
+}
+
+bool FThirdwebJsonReader::Read(int32& Out)
+{
+	if (double Value; Read(Value))
+	{
+		Out = static_cast<int32>(Value);
+		return true;
+	}
+	return false;
+}
+
+bool FThirdwebJsonReader::Read(int64& Out)
+{
+	if (double Value; Read(Value))
+	{
+		Out = static_cast<int64>(Value);
+		return true;
+	}
+	return false;
+}
+
+void FThirdwebJsonReader::Skip()
+{
+	FUtf8StringView Unused;
+	bool bEscaped;
+	switch (Peek())
+	{
+	case EJson::Object:
+		ReadObject([](const FUtf8StringView) {});
+		break;
+	case EJson::Array:
+		ReadArray([]() {});
+		break;
+	case EJson::String:
+		ReadStringToken(Unused, bEscaped);
+		break;
+	case EJson::Number:
+		ReadNumberToken(Unused);
+		break;
+	case EJson::Boolean:
+		ReadLiteral(Data[Offset] == 't' ? "true" : "false");
+		break;
+	case EJson::Null:
+		ReadLiteral("null");
+		break;
+	default:
+		if (!HasError())
+		{
+			SetError(Offset >= Num ? TEXT("Unexpected end of input") : TEXT("Unexpected character"));
+		}
+		break;
+	}
+}
+
+void FThirdwebJsonReader::SkipWhitespace()
+{
+	while (Offset < Num && (Data[Offset] == ' ' || Data[Offset] == '\t' || Data[Offset] == '\n' || Data[Offset] == '\r'))
+	{
+		Offset++;
+	}
+}
+
+bool FThirdwebJsonReader::Consume(const ANSICHAR Char)
+{
+	if (Offset < Num && Data[Offset] == Char)
+	{
+		Offset++;
+		return true;
+	}
+	return false;
+}
+
+bool FThirdwebJsonReader::ReadStringToken(FUtf8StringView& OutRaw, bool& bOutEscaped)
+{
+	bOutEscaped = false;
+	if (!Consume('"'))
+	{
+		SetError(TEXT("Expected string"));
+		return false;
+	}
+	const int32 Start = Offset;
+	while (Offset < Num)
+	{
+		const UTF8CHAR Char = Data[Offset];
+		if (Char == '"')
+		{
+			OutRaw = FUtf8StringView(Data + Start, Offset - Start);
+			Offset++;
+			return true;
+		}
+		if (Char == '\\')
+		{
+			bOutEscaped = true;
+			Offset++;
+		}
+		Offset++;
+	}
+	SetError(TEXT("Unterminated string"));
+	return false;
+}
+
+bool FThirdwebJsonReader::ReadNumberToken(FUtf8StringView& OutToken)
+{
+	const int32 Start = Offset;
+	Consume('-');
+	while (Offset < Num)
+	{
+		const UTF8CHAR Char = Data[Offset];
+		if (!ThirdwebJsonReader::IsDigit(Char) && Char != '.' && Char != 'e' && Char != 'E' && Char != '+' && Char != '-')
+		{
+			break;
+		}
+		Offset++;
+	}
+	if (Offset == Start || !ThirdwebJsonReader::IsDigit(Data[Offset - 1]))
+	{
+		SetError(TEXT("Malformed number"));
+		return false;
+	}
+	OutToken = FUtf8StringView(Data + Start, Offset - Start);
+	return true;
+}
+
+bool FThirdwebJsonReader::ReadLiteral(const ANSICHAR* Literal)
+{
+	const int32 Len = FCStringAnsi::Strlen(Literal);
+	if (Offset + Len > Num || FMemory::Memcmp(Data + Offset, Literal, Len) != 0)
+	{
+		SetError(TEXT("Malformed literal"));
+		return false;
+	}
+	Offset += Len;
+	return true;
+}
+
+bool FThirdwebJsonReader::Unescape(const FUtf8StringView Raw, TArray<UTF8CHAR>& Out)
+{
+	Out.Reset(Raw.Len());
+	for (int32 i = 0; i < Raw.Len(); i++)
+	{
+		const UTF8CHAR Char = Raw[i];
+		if (Char != '\\')
+		{
+			Out.Add(Char);
+			continue;
+		}
+		if (++i >= Raw.Len())
+		{
+			SetError(TEXT("Malformed escape sequence"));
+			return false;
+		}
+		switch (Raw[i])
+		{
+		case '"': Out.Add('"'); break;
+		case '\\': Out.Add('\\'); break;
+		case '/': Out.Add('/'); break;
+		case 'b': Out.Add('\b'); break;
+		case 'f': Out.Add('\f'); break;
+		case 'n': Out.Add('\n'); break;
+		case 'r': Out.Add('\r'); break;
+		case 't': Out.Add('\t'); break;
+		case 'u':
+			{
+				auto ReadHex = [&Raw, &i](uint32& OutValue)
+				{
+					if (i + 4 >= Raw.Len())
+					{
+						return false;
+					}
+					OutValue = 0;
+					for (int32 Digit = 1; Digit <= 4; Digit++)
+					{
+						const int32 Value = ThirdwebJsonReader::HexValue(Raw[i + Digit]);
+						if (Value < 0)
+						{
+							return false;
+						}
+						OutValue = OutValue << 4 | Value;
+					}
+					i += 4;
+					return true;
+				};
+				uint32 Codepoint;
+				if (!ReadHex(Codepoint))
+				{
+					SetError(TEXT("Malformed unicode escape"));
+					return false;
+				}
+				// Surrogate pair
+				if (Codepoint >= 0xD800 && Codepoint <= 0xDBFF && i + 2 < Raw.Len() && Raw[i + 1] == '\\' && Raw[i + 2] == 'u')
+				{
+					i += 2;
+					uint32 Low;
+					if (!ReadHex(Low) || Low < 0xDC00 || Low > 0xDFFF)
+					{
+						SetError(TEXT("Malformed surrogate pair"));
+						return false;
+					}
+					Codepoint = 0x10000 + ((Codepoint - 0xD800) << 10) + (Low - 0xDC00);
+				}
+				ThirdwebJsonReader::AppendCodepoint(Out, Codepoint);
+				break;
+			}
+		default:
+			SetError(TEXT("Malformed escape sequence"));
+			return false;
+		}
+	}
+	return true;
+}
+
+void FThirdwebJsonReader::SetError(const TCHAR* Message)
+{
+	if (!HasError())
+	{
+		Error = FString::Printf(TEXT("%s at offset %d"), Message, Offset);
+	}
+}
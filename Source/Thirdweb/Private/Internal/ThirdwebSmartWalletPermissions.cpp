@@ -0,0 +1,120 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Internal/ThirdwebSmartWalletPermissions.h"
+
+#include "ThirdwebRuntimeSettings.h"
+#include "Misc/ScopeRWLock.h"
+
+uint32 FThirdwebSmartWalletPermissions::GetGeneration() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Generation;
+}
+
+bool FThirdwebSmartWalletPermissions::IsDeployed() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return bDeployed;
+}
+
+void FThirdwebSmartWalletPermissions::SetDeployed()
+{
+	FWriteScopeLock WriteLock(Lock);
+	bDeployed = true;
+}
+
+TOptional<TArray<FSigner>> FThirdwebSmartWalletPermissions::GetActiveSigners() const
+{
+	FReadScopeLock ReadLock(Lock);
+	if (!IsFresh(SignersFetchedAt))
+	{
+		return {};
+	}
+	const FDateTime Now = FDateTime::UtcNow();
+	TArray<FSigner> Active;
+	Active.Reserve(Signers.Num());
+	for (const TPair<FString, FSigner>& Signer : Signers)
+	{
+		if (IsActiveAt(Signer.Value, Now))
+		{
+			Active.Add(Signer.Value);
+		}
+	}
+	return Active;
+}
+
+void FThirdwebSmartWalletPermissions::SetActiveSigners(const TArray<FSigner>& InSigners, const uint32 InGeneration)
+{
+	FWriteScopeLock WriteLock(Lock);
+	if (InGeneration != Generation)
+	{
+		return;
+	}
+	Signers.Reset();
+	for (const FSigner& Signer : InSigners)
+	{
+		Signers.Add(Signer.Address, Signer);
+	}
+	SignersFetchedAt = FPlatformTime::Seconds();
+}
+
+TOptional<bool> FThirdwebSmartWalletPermissions::IsActiveSigner(const FString& Address) const
+{
+	FReadScopeLock ReadLock(Lock);
+	if (!IsFresh(SignersFetchedAt))
+	{
+		return {};
+	}
+	const FSigner* Signer = Signers.Find(Address);
+	return Signer && IsActiveAt(*Signer, FDateTime::UtcNow());
+}
+
+TOptional<TArray<FString>> FThirdwebSmartWalletPermissions::GetAdmins() const
+{
+	FReadScopeLock ReadLock(Lock);
+	if (!IsFresh(AdminsFetchedAt))
+	{
+		return {};
+	}
+	return Admins.Array();
+}
+
+void FThirdwebSmartWalletPermissions::SetAdmins(const TArray<FString>& InAdmins, const uint32 InGeneration)
+{
+	FWriteScopeLock WriteLock(Lock);
+	if (InGeneration != Generation)
+	{
+		return;
+	}
+	Admins = TSet<FString>(InAdmins);
+	AdminsFetchedAt = FPlatformTime::Seconds();
+}
+
+TOptional<bool> FThirdwebSmartWalletPermissions::IsAdmin(const FString& Address) const
+{
+	FReadScopeLock ReadLock(Lock);
+	if (!IsFresh(AdminsFetchedAt))
+	{
+		return {};
+	}
+	return Admins.Contains(Address);
+}
+
+void FThirdwebSmartWalletPermissions::InvalidateSigners()
+{
+	FWriteScopeLock WriteLock(Lock);
+	++Generation;
+	SignersFetchedAt = 0.0;
+}
+
+void FThirdwebSmartWalletPermissions::InvalidateAdmins()
+{
+	FWriteScopeLock WriteLock(Lock);
+	++Generation;
+	AdminsFetchedAt = 0.0;
+}
+
+bool FThirdwebSmartWalletPermissions::IsFresh(const double FetchedAt) const
+{
+	return FetchedAt > 0.0 && FPlatformTime::Seconds() - FetchedAt < UThirdwebRuntimeSettings::GetSmartWalletPermissionCacheTTL();
+}
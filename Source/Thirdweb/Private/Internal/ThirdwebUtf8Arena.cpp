@@ -0,0 +1,46 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Internal/ThirdwebUtf8Arena.h"
+
+const char* FThirdwebUtf8Arena::Add(const FString& String)
+{
+	if (String.IsEmpty())
+	{
+		return nullptr;
+	}
+	const int32 Length = FPlatformString::ConvertedLength<UTF8CHAR>(*String, String.Len());
+	UTF8CHAR* Dest = reinterpret_cast<UTF8CHAR*>(Allocate(Length + 1, 1));
+	FPlatformString::Convert(Dest, Length, *String, String.Len());
+	Dest[Length] = '\0';
+	return reinterpret_cast<const char*>(Dest);
+}
+
+const char* const* FThirdwebUtf8Arena::Add(const TArray<FString>& Strings)
+{
+	if (Strings.Num() == 0)
+	{
+		return nullptr;
+	}
+	const char** Pointers = reinterpret_cast<const char**>(Allocate(Strings.Num() * sizeof(const char*), alignof(const char*)));
+	for (int32 i = 0; i < Strings.Num(); i++)
+	{
+		// The library reads every entry, so empty strings are passed as such rather than as nullptr
+		Pointers[i] = Strings[i].IsEmpty() ? "" : Add(Strings[i]);
+	}
+	return Pointers;
+}
+
+uint8* FThirdwebUtf8Arena::Allocate(const int32 Size, const int32 Alignment)
+{
+	uint8* Aligned = Align(Cursor, Alignment);
+	if (Aligned + Size > End)
+	{
+		const int32 BlockSize = FMath::Max(MinBlockSize, Size + Alignment);
+		uint8* Block = Blocks.Emplace_GetRef(MakeUnique<uint8[]>(BlockSize)).Get();
+		Aligned = Align(Block, Alignment);
+		End = Block + BlockSize;
+	}
+	Cursor = Aligned + Size;
+	Used += Size;
+	return Aligned;
+}
@@ -0,0 +1,147 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Internal/ThirdwebWalletMetadataCache.h"
+
+#include "Thirdweb.h"
+#include "ThirdwebLog.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+
+FThirdwebWalletMetadata::FThirdwebWalletMetadata(const int64 InID, const FWalletHandle::EWalletHandleType InType) : ID(InID), Type(InType)
+{
+	FThirdwebWalletMetadataCache& Cache = FThirdwebWalletMetadataCache::Get();
+	++Cache.Live;
+	++Cache.Created;
+}
+
+FThirdwebWalletMetadata::~FThirdwebWalletMetadata()
+{
+	FThirdwebWalletMetadataCache::Get().Remove(ID);
+	Release();
+	// Only now may the signer of a smart wallet go, after the smart wallet itself
+	Signer.Reset();
+}
+
+bool FThirdwebWalletMetadata::GetAddress(FString& OutAddress) const
+{
+	if (const FString* Cached = Address.load(std::memory_order_acquire))
+	{
+		OutAddress = *Cached;
+		return true;
+	}
+	return false;
+}
+
+void FThirdwebWalletMetadata::SetAddress(const FString& InAddress, const uint32 InGeneration)
+{
+	if (InAddress.IsEmpty())
+	{
+		return;
+	}
+	FScopeLock ScopeLock(&Lock);
+	if (InGeneration != Generation.load(std::memory_order_relaxed) || Address.load(std::memory_order_relaxed))
+	{
+		return;
+	}
+	Address.store(Addresses.Emplace_GetRef(MakeUnique<FString>(InAddress)).Get(), std::memory_order_release);
+}
+
+void FThirdwebWalletMetadata::SetConnected(const uint32 InGeneration)
+{
+	FScopeLock ScopeLock(&Lock);
+	if (InGeneration == Generation.load(std::memory_order_relaxed))
+	{
+		bConnected.store(true, std::memory_order_release);
+	}
+}
+
+void FThirdwebWalletMetadata::SetSigner(const TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe>& InSigner)
+{
+	FScopeLock ScopeLock(&Lock);
+	Signer = InSigner;
+}
+
+void FThirdwebWalletMetadata::Invalidate()
+{
+	FScopeLock ScopeLock(&Lock);
+	Generation.fetch_add(1, std::memory_order_acq_rel);
+	Address.store(nullptr, std::memory_order_release);
+	bConnected.store(false, std::memory_order_release);
+}
+
+bool FThirdwebWalletMetadata::Release()
+{
+	if (bReleased.exchange(true, std::memory_order_acq_rel))
+	{
+		return false;
+	}
+	Invalidate();
+	Thirdweb::free_wallet(ID);
+
+	FThirdwebWalletMetadataCache& Cache = FThirdwebWalletMetadataCache::Get();
+	--Cache.Live;
+	++Cache.Freed;
+	TW_LOG(VeryVerbose, TEXT("FThirdwebWalletMetadata::Release::%lld::Live=%d"), ID, Cache.GetLiveCount())
+	return true;
+}
+
+FThirdwebWalletMetadataCache& FThirdwebWalletMetadataCache::Get()
+{
+	static FThirdwebWalletMetadataCache Cache;
+	return Cache;
+}
+
+TSharedRef<FThirdwebWalletMetadata, ESPMode::ThreadSafe> FThirdwebWalletMetadataCache::FindOrAdd(const int64 ID, const FWalletHandle::EWalletHandleType Type)
+{
+	if (TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe> Entry = Find(ID))
+	{
+		return Entry.ToSharedRef();
+	}
+	FWriteScopeLock WriteLock(Lock);
+	TWeakPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe>& Slot = Entries.FindOrAdd(ID);
+	if (TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe> Entry = Slot.Pin())
+	{
+		return Entry.ToSharedRef();
+	}
+	TSharedRef<FThirdwebWalletMetadata, ESPMode::ThreadSafe> Entry = MakeShared<FThirdwebWalletMetadata, ESPMode::ThreadSafe>(ID, Type);
+	Slot = Entry;
+	return Entry;
+}
+
+void FThirdwebWalletMetadataCache::Link(const int64 InAppWalletID, const int64 SmartWalletID)
+{
+	const TSharedRef<FThirdwebWalletMetadata, ESPMode::ThreadSafe> InApp = FindOrAdd(InAppWalletID, FWalletHandle::InApp);
+	const TSharedRef<FThirdwebWalletMetadata, ESPMode::ThreadSafe> Smart = FindOrAdd(SmartWalletID, FWalletHandle::Smart);
+	InApp->SetLinkedWalletID(SmartWalletID);
+	Smart->SetLinkedWalletID(InAppWalletID);
+	Smart->SetSigner(InApp);
+}
+
+void FThirdwebWalletMetadataCache::Invalidate(const int64 ID)
+{
+	if (const TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe> Entry = Find(ID))
+	{
+		Entry->Invalidate();
+		// A smart wallet is only as connected as the in-app wallet signing for it
+		if (const TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe> Linked = Find(Entry->GetLinkedWalletID()))
+		{
+			Linked->Invalidate();
+		}
+	}
+}
+
+TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe> FThirdwebWalletMetadataCache::Find(const int64 ID) const
+{
+	FReadScopeLock ReadLock(Lock);
+	const TWeakPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe>* Slot = Entries.Find(ID);
+	return Slot ? Slot->Pin() : nullptr;
+}
+
+void FThirdwebWalletMetadataCache::Remove(const int64 ID)
+{
+	FWriteScopeLock WriteLock(Lock);
+	if (const TWeakPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe>* Slot = Entries.Find(ID); Slot && !Slot->IsValid())
+	{
+		Entries.Remove(ID);
+	}
+}
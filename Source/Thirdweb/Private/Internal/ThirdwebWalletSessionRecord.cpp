@@ -0,0 +1,68 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Internal/ThirdwebWalletSessionRecord.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "ThirdwebUtils.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+bool FThirdwebWalletSessionRecord::Load(FThirdwebWalletSessionRecord& Record)
+{
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *GetPath()))
+	{
+		return false;
+	}
+	const TSharedPtr<FJsonObject> JsonObject = ThirdwebUtils::Json::ToJson(Content);
+	if (!JsonObject.IsValid() || JsonObject->GetStringField(TEXT("scope")) != GetScope())
+	{
+		TW_LOG(Verbose, TEXT("FThirdwebWalletSessionRecord::Load::Ignoring record of other settings"))
+		return false;
+	}
+	int32 Source = 0;
+	int32 Provider = 0;
+	JsonObject->TryGetNumberField(TEXT("source"), Source);
+	JsonObject->TryGetNumberField(TEXT("provider"), Provider);
+	Record.Source = static_cast<uint8>(Source);
+	Record.Provider = static_cast<uint8>(Provider);
+	JsonObject->TryGetStringField(TEXT("authInput"), Record.AuthInput);
+	JsonObject->TryGetStringField(TEXT("address"), Record.Address);
+	return Record.Source != 0 && !Record.Address.IsEmpty();
+}
+
+void FThirdwebWalletSessionRecord::Save() const
+{
+	const TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetStringField(TEXT("scope"), GetScope());
+	JsonObject->SetNumberField(TEXT("source"), Source);
+	JsonObject->SetNumberField(TEXT("provider"), Provider);
+	JsonObject->SetStringField(TEXT("authInput"), AuthInput);
+	JsonObject->SetStringField(TEXT("address"), Address);
+	// Written aside and moved in place, so a crash never leaves a torn record behind
+	const FString Path = GetPath();
+	if (const FString TempPath = Path + TEXT(".tmp"); FFileHelper::SaveStringToFile(ThirdwebUtils::Json::ToString(JsonObject), *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		IFileManager::Get().Move(*Path, *TempPath, true);
+	}
+}
+
+void FThirdwebWalletSessionRecord::Clear()
+{
+	IFileManager::Get().Delete(*GetPath(), false, false, true);
+}
+
+FString FThirdwebWalletSessionRecord::GetPath()
+{
+	return FPaths::Combine(UThirdwebRuntimeSettings::GetStorageDirectory(), TEXT("LastSession.json"));
+}
+
+FString FThirdwebWalletSessionRecord::GetScope()
+{
+	return UThirdwebRuntimeSettings::IsEcosystem()
+		       ? FString::Printf(TEXT("%s:%s"), *UThirdwebRuntimeSettings::GetClientId(), *UThirdwebRuntimeSettings::GetEcosystemId())
+		       : UThirdwebRuntimeSettings::GetClientId();
+}
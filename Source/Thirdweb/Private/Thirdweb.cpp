@@ -3,17 +3,20 @@
 #include "Thirdweb.h"
 
 #include "ThirdwebLog.h"
+#include "Internal/ThirdwebJsonReader.h"
 
 bool Thirdweb::FFIResult::AssignResult(FString& Output, const bool bErrorOnlyResult) const
 {
 	Log();
 	bool bSuccess = success;
-	Output = FString(UTF8_TO_TCHAR(message));
-
 	if (bSuccess && bErrorOnlyResult)
 	{
 		Output.Empty();
 	}
+	else
+	{
+		Output = FString(UTF8_TO_TCHAR(message));
+	}
 	free_ffi_result(*this);
 	return bSuccess;
 }
@@ -33,5 +36,40 @@ void Thirdweb::FFIResult::Free() const
 
 void Thirdweb::FFIResult::Log() const
 {
-	TW_LOG(VeryVerbose, TEXT("FFIResult: success=%s, message=%s"), success ? TEXT("true") : TEXT("false"), *FString(UTF8_TO_TCHAR(message)));
+	// Checked up front so that nothing is converted unless the message is actually printed
+	if (UE_LOG_ACTIVE(LogThirdweb, VeryVerbose))
+	{
+		TW_LOG(VeryVerbose, TEXT("FFIResult: success=%s, message=%s"), success ? TEXT("true") : TEXT("false"), message ? UTF8_TO_TCHAR(message) : TEXT(""));
+	}
+}
+
+FUtf8StringView Thirdweb::FFIResult::View() const
+{
+	return message ? FUtf8StringView(reinterpret_cast<const UTF8CHAR*>(message)) : FUtf8StringView();
+}
+
+bool Thirdweb::FFIResult::GetBool() const
+{
+	Log();
+	const bool bOutput = success && message && FCStringAnsi::Stricmp(message, "true") == 0;
+	free_ffi_result(*this);
+	return bOutput;
+}
+
+bool Thirdweb::FFIResult::ReadJson(TFunctionRef<void(FThirdwebJsonReader& Reader)> ReadOutput, FString& Error) const
+{
+	Log();
+	const bool bSuccess = success;
+	if (bSuccess)
+	{
+		const FUtf8StringView Output = View();
+		FThirdwebJsonReader Reader(TConstArrayView<uint8>(reinterpret_cast<const uint8*>(Output.GetData()), Output.Len()));
+		ReadOutput(Reader);
+	}
+	else
+	{
+		Error = FString(UTF8_TO_TCHAR(message));
+	}
+	free_ffi_result(*this);
+	return bSuccess;
 }
@@ -8,7 +8,9 @@
 #include "ThirdwebCommon.h"
 #include "ThirdwebUtils.h"
 #include "Containers/ThirdwebCountryCodes.h"
+#include "Engine/ThirdwebEngineClient.h"
 #include "Engine/Transaction/ThirdwebEngineTransactionStatusResult.h"
+#include "Engine/Transaction/ThirdwebEngineWriteJournal.h"
 #include "Wallets/ThirdwebInAppWalletHandle.h"
 #include "Wallets/ThirdwebSmartWalletHandle.h"
 #include "Wallets/ThirdwebWalletHandle.h"
@@ -63,6 +65,11 @@ void UThirdwebFunctionLibrary::BP_DisconnectWallet(const FInAppWalletHandle& Wal
 	return Wallet.Disconnect();
 }
 
+void UThirdwebFunctionLibrary::BP_ReleaseInAppWallet(const FInAppWalletHandle& Wallet)
+{
+	Wallet.Release();
+}
+
 
 EFunctionResult UThirdwebFunctionLibrary::BP_FetchOAuthLoginLink(FInAppWalletHandle Wallet, const FString& RedirectUrl, FString& LoginLink, FString& Error)
 {
@@ -79,6 +86,11 @@ bool UThirdwebFunctionLibrary::BP_SmartWalletIsValid(const FSmartWalletHandle& W
 	return Wallet.IsValid();
 }
 
+void UThirdwebFunctionLibrary::BP_ReleaseSmartWallet(const FSmartWalletHandle& Wallet)
+{
+	Wallet.Release();
+}
+
 FText UThirdwebFunctionLibrary::Conv_ThirdwebOAuthProviderToText(EThirdwebOAuthProvider Provider)
 {
 	return ThirdwebUtils::ToText(Provider);
@@ -155,3 +167,22 @@ void UThirdwebFunctionLibrary::BP_GetTransactionReceiptInputs(const FThirdwebEng
 	ChainID = TransactionStatus.ChainId;
 }
 
+int32 UThirdwebFunctionLibrary::BP_GetEngineQueueDepth()
+{
+	return FThirdwebEngineClient::Get().GetQueueDepth();
+}
+
+int32 UThirdwebFunctionLibrary::BP_GetEngineInFlightCount()
+{
+	return FThirdwebEngineClient::Get().GetInFlightCount();
+}
+
+void UThirdwebFunctionLibrary::BP_InvalidateEngineCache(const FString& ContractAddress)
+{
+	FThirdwebEngineClient::Get().InvalidateCache(ContractAddress);
+}
+
+int32 UThirdwebFunctionLibrary::BP_ReplayEngineWrites()
+{
+	return FThirdwebEngineWriteJournal::Get().Replay();
+}
@@ -2,7 +2,10 @@
 
 #include "ThirdwebModule.h"
 
+#include "Engine/Transaction/ThirdwebEngineWriteJournal.h"
+#include "Internal/ThirdwebFFIExecutor.h"
 #include "IWebBrowserSingleton.h"
+#include "Misc/CoreDelegates.h"
 #include "ThirdwebAssetManager.h"
 #include "ThirdwebLog.h"
 #include "WebBrowserModule.h"
@@ -38,14 +41,26 @@ public:
 				}
 			}
 		}
+
+		// Writes left unanswered by the previous run go out again once HTTP is up. Editor sessions replay on demand instead
+		PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddLambda([]
+		{
+			if (!GIsEditor && FThirdwebEngineWriteJournal::IsEnabled())
+			{
+				FThirdwebEngineWriteJournal::Get().Replay();
+			}
+		});
 	}
 
 	virtual void ShutdownModule() override
 	{
+		FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+		FThirdwebFFIExecutor::ShutdownIfCreated();
 	}
 
 private:
 	UThirdwebAssetManager* ThirdwebAssetManager = nullptr;
+	FDelegateHandle PostEngineInitHandle;
 };
 
 IMPLEMENT_MODULE(FThirdwebModule, Thirdweb);
@@ -25,6 +25,33 @@ const FString UThirdwebRuntimeSettings::DefaultExternalAuthRedirectUri = TEXT("h
 UThirdwebRuntimeSettings::UThirdwebRuntimeSettings()
 {
 	bSendAnalytics = true;
+	EngineMaxConcurrentRequests = 16;
+	EngineAsyncDecodeThreshold = 4096;
+	// Caching changes how fresh reads are, so no endpoint is cached unless the project opts in
+	EngineCacheTTLs = {};
+	EngineCacheStaleWhileRevalidate = 0.0f;
+	EngineCacheMaxMemoryMB = 16;
+	EngineMaxRetries = 3;
+	EngineRetryBaseDelay = 0.5f;
+	EngineRetryMaxDelay = 10.0f;
+	EngineCircuitBreakerThreshold = 5;
+	EngineCircuitBreakerCooldown = 15.0f;
+	EngineEjectionErrorRate = 0.5f;
+	EngineEjectionLatency = 5.0f;
+	EngineEjectionDuration = 30.0f;
+	EngineHedgeDelay = 0.0f;
+	EngineTransactionPollInterval = 1.0f;
+	EngineTransactionMaxPollInterval = 15.0f;
+	EngineTransactionPollRate = 5.0f;
+	bEngineTransactionStreaming = false;
+	EngineTransactionMaxStreams = 32;
+	EngineWriteBatchWindow = 0.05f;
+	EngineWriteBatchMaxSize = 50;
+	bEngineWriteJournal = false;
+	WalletThreadCount = 4;
+	WalletSessionIdleTimeout = 1800.0f;
+	MaxWalletSessions = 0;
+	SmartWalletPermissionCacheTTL = 60.0f;
 	bOverrideExternalAuthRedirectUri = false;
 	CustomExternalAuthRedirectUri = DefaultExternalAuthRedirectUri;
 	bOverrideOAuthBrowserProviderBackends = false;
@@ -83,7 +110,7 @@ void UThirdwebRuntimeSettings::PostEditChangeProperty(struct FPropertyChangedEve
 			PropertyChangedEvent.Property->SetValue_InContainer(this, &NewValue);
 		}
 	}
-	if (CurrentPropertyName == GET_MEMBER_NAME_CHECKED(UThirdwebRuntimeSettings, EngineSigners))
+	if (CurrentPropertyName == GET_MEMBER_NAME_CHECKED(UThirdwebRuntimeSettings, EngineSigners) || CurrentPropertyName == GET_MEMBER_NAME_CHECKED(UThirdwebRuntimeSettings, EngineReplicaBaseUrls))
 	{
 		bool bArrayChanged = false;
 		TArray<FString> Values;
@@ -266,6 +293,94 @@ FString UThirdwebRuntimeSettings::GetEngineBaseUrl()
 	return TEXT("");
 }
 
+float UThirdwebRuntimeSettings::GetEngineWriteBatchWindow()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->EngineWriteBatchWindow);
+	}
+	return 0.05f;
+}
+
+int32 UThirdwebRuntimeSettings::GetEngineWriteBatchMaxSize()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(1, Settings->EngineWriteBatchMaxSize);
+	}
+	return 50;
+}
+
+bool UThirdwebRuntimeSettings::IsEngineWriteJournalEnabled()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return Settings->bEngineWriteJournal;
+	}
+	return false;
+}
+
+int32 UThirdwebRuntimeSettings::GetWalletThreadCount()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(1, Settings->WalletThreadCount);
+	}
+	return 4;
+}
+
+float UThirdwebRuntimeSettings::GetWalletSessionIdleTimeout()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->WalletSessionIdleTimeout);
+	}
+	return 1800.0f;
+}
+
+int32 UThirdwebRuntimeSettings::GetMaxWalletSessions()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0, Settings->MaxWalletSessions);
+	}
+	return 0;
+}
+
+float UThirdwebRuntimeSettings::GetSmartWalletPermissionCacheTTL()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->SmartWalletPermissionCacheTTL);
+	}
+	return 60.0f;
+}
+
+TArray<FString> UThirdwebRuntimeSettings::GetEngineBaseUrls()
+{
+	TArray<FString> Urls;
+	if (FString Primary = GetEngineBaseUrl(); !Primary.IsEmpty())
+	{
+		Urls.Emplace(Primary);
+	}
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		for (const FString& Replica : Settings->EngineReplicaBaseUrls)
+		{
+			FString Url = Replica.TrimStartAndEnd();
+			if (Url.EndsWith("/"))
+			{
+				Url.LeftChopInline(1);
+			}
+			if (!Url.IsEmpty())
+			{
+				Urls.AddUnique(Url);
+			}
+		}
+	}
+	return Urls;
+}
+
 FString UThirdwebRuntimeSettings::GetEngineAccessToken()
 {
 	if (const UThirdwebRuntimeSettings* Settings = Get())
@@ -275,6 +390,190 @@ FString UThirdwebRuntimeSettings::GetEngineAccessToken()
 	return TEXT("");
 }
 
+int32 UThirdwebRuntimeSettings::GetEngineMaxConcurrentRequests()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return Settings->EngineMaxConcurrentRequests;
+	}
+	return 0;
+}
+
+int32 UThirdwebRuntimeSettings::GetEngineAsyncDecodeThreshold()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0, Settings->EngineAsyncDecodeThreshold);
+	}
+	return 0;
+}
+
+float UThirdwebRuntimeSettings::GetEngineCacheTTL(const FString& Endpoint)
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		if (const float* TTL = Settings->EngineCacheTTLs.Find(Endpoint))
+		{
+			return FMath::Max(0.0f, *TTL);
+		}
+	}
+	return 0.0f;
+}
+
+float UThirdwebRuntimeSettings::GetEngineCacheStaleWhileRevalidate()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->EngineCacheStaleWhileRevalidate);
+	}
+	return 0.0f;
+}
+
+int64 UThirdwebRuntimeSettings::GetEngineCacheMaxMemory()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return static_cast<int64>(FMath::Max(0, Settings->EngineCacheMaxMemoryMB)) * 1024 * 1024;
+	}
+	return 0;
+}
+
+int32 UThirdwebRuntimeSettings::GetEngineMaxRetries()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0, Settings->EngineMaxRetries);
+	}
+	return 0;
+}
+
+float UThirdwebRuntimeSettings::GetEngineRetryBaseDelay()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->EngineRetryBaseDelay);
+	}
+	return 0.5f;
+}
+
+float UThirdwebRuntimeSettings::GetEngineRetryMaxDelay()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->EngineRetryMaxDelay);
+	}
+	return 10.0f;
+}
+
+int32 UThirdwebRuntimeSettings::GetEngineCircuitBreakerThreshold()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0, Settings->EngineCircuitBreakerThreshold);
+	}
+	return 0;
+}
+
+float UThirdwebRuntimeSettings::GetEngineCircuitBreakerCooldown()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->EngineCircuitBreakerCooldown);
+	}
+	return 15.0f;
+}
+
+float UThirdwebRuntimeSettings::GetEngineEjectionErrorRate()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Clamp(Settings->EngineEjectionErrorRate, 0.0f, 1.0f);
+	}
+	return 0.5f;
+}
+
+float UThirdwebRuntimeSettings::GetEngineEjectionLatency()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->EngineEjectionLatency);
+	}
+	return 0.0f;
+}
+
+float UThirdwebRuntimeSettings::GetEngineEjectionDuration()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->EngineEjectionDuration);
+	}
+	return 30.0f;
+}
+
+float UThirdwebRuntimeSettings::GetEngineHedgeDelay()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->EngineHedgeDelay);
+	}
+	return 0.0f;
+}
+
+float UThirdwebRuntimeSettings::GetEngineTransactionPollInterval()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.1f, Settings->EngineTransactionPollInterval);
+	}
+	return 1.0f;
+}
+
+float UThirdwebRuntimeSettings::GetEngineTransactionMaxPollInterval()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(GetEngineTransactionPollInterval(), Settings->EngineTransactionMaxPollInterval);
+	}
+	return 15.0f;
+}
+
+float UThirdwebRuntimeSettings::GetEngineTransactionPollRate()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(0.0f, Settings->EngineTransactionPollRate);
+	}
+	return 5.0f;
+}
+
+bool UThirdwebRuntimeSettings::IsEngineTransactionStreamingEnabled()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return Settings->bEngineTransactionStreaming;
+	}
+	return false;
+}
+
+int32 UThirdwebRuntimeSettings::GetEngineTransactionMaxStreams()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		return FMath::Max(1, Settings->EngineTransactionMaxStreams);
+	}
+	return 32;
+}
+
+FString UThirdwebRuntimeSettings::GetEngineTransactionStreamBaseUrl()
+{
+	if (const UThirdwebRuntimeSettings* Settings = Get())
+	{
+		FString Url = Settings->EngineTransactionStreamBaseUrl.TrimStartAndEnd();
+		return Url.EndsWith("/") ? Url.LeftChop(1) : Url;
+	}
+	return TEXT("");
+}
+
 FString UThirdwebRuntimeSettings::GetAppUri()
 {
 	if (const UThirdwebRuntimeSettings* Settings = Get())
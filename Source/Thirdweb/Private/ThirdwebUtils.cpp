@@ -42,9 +42,9 @@ namespace ThirdwebUtils
 {
 	const TCHAR* ZeroAddress = TEXT("0x0000000000000000000000000000000000000000");
 
-	bool IsChecksummedAddress(const FString& Address) { return Thirdweb::is_valid_address(TO_RUST_STRING(Address), true).GetOutput().ToBool(); }
+	bool IsChecksummedAddress(const FString& Address) { return Thirdweb::is_valid_address(TO_RUST_STRING(Address), true).GetBool(); }
 
-	bool IsValidAddress(const FString& Address, const bool bWithChecksum) { return Thirdweb::is_valid_address(TO_RUST_STRING(Address), bWithChecksum).GetOutput().ToBool(); }
+	bool IsValidAddress(const FString& Address, const bool bWithChecksum) { return Thirdweb::is_valid_address(TO_RUST_STRING(Address), bWithChecksum).GetBool(); }
 
 	FString ToChecksummedAddress(const FString& Address) { return Thirdweb::to_checksummed_address(TO_RUST_STRING(Address)).GetOutput(); }
 
@@ -474,6 +474,7 @@ namespace ThirdwebUtils
 				Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 			}
 			Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
+			Request->SetHeader(TEXT("Connection"), TEXT("keep-alive"));
 			Request->SetHeader(TEXT("authorization"), TEXT("Bearer ") + UThirdwebRuntimeSettings::GetEngineAccessToken());
 			Request->SetTimeout(30.0f);
 			return Request;
@@ -11,8 +11,11 @@
 #include "ThirdwebRuntimeSettings.h"
 #include "ThirdwebUtils.h"
 #include "Containers/ThirdwebLinkedAccount.h"
+#include "Internal/ThirdwebFFIExecutor.h"
+#include "Internal/ThirdwebUtf8Arena.h"
+#include "Internal/ThirdwebWalletMetadataCache.h"
+#include "Internal/ThirdwebWalletSessionRecord.h"
 #include "Misc/DefaultValueHelper.h"
-#include "Tasks/Task.h"
 
 #define CHECK_ECOSYSTEM(ErrorDelegate) \
 	if (UThirdwebRuntimeSettings::GetEcosystemId().IsEmpty()) \
@@ -53,6 +56,7 @@ FInAppWalletHandle::FInAppWalletHandle(const EInAppSource InSource, const int64
 	Source = InSource;
 	ensureAlwaysMsgf(InID > 0, TEXT("Invalid id 0"));
 	ID = InID;
+	BindMetadata();
 }
 
 FInAppWalletHandle::FInAppWalletHandle(const EInAppSource InSource, const FString& Int64String)
@@ -65,6 +69,7 @@ FInAppWalletHandle::FInAppWalletHandle(const EInAppSource InSource, const FStrin
 	FDefaultValueHelper::ParseInt64(Int64String, InID);
 	ensureAlwaysMsgf(InID > 0, TEXT("Invalid id 0"));
 	ID = InID;
+	BindMetadata();
 }
 
 FInAppWalletHandle::FInAppWalletHandle(const EThirdwebOAuthProvider InProvider, const FString& Int64String)
@@ -77,6 +82,7 @@ FInAppWalletHandle::FInAppWalletHandle(const EThirdwebOAuthProvider InProvider,
 	FDefaultValueHelper::ParseInt64(Int64String, InID);
 	ensureAlwaysMsgf(InID > 0, TEXT("Invalid id 0"));
 	ID = InID;
+	BindMetadata();
 }
 
 bool FInAppWalletHandle::IsValid() const
@@ -88,40 +94,45 @@ void FInAppWalletHandle::CreateEmailWallet(const FString& Email, const FCreateIn
 {
 	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate)
 
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Email, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [Email, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
 			if (Thirdweb::create_ecosystem_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetEcosystemId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetPartnerId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetEcosystemId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetPartnerId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
-				TO_RUST_STRING(Email),
+				Arena.Add(Email),
 				nullptr,
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
 				nullptr
 			).AssignResult(Error))
 			{
-				SuccessDelegate.Execute(FInAppWalletHandle(EInAppSource::Email, Error));
+				FInAppWalletHandle Wallet(EInAppSource::Email, Error);
+				Wallet.AuthInput = Email;
+				SuccessDelegate.Execute(Wallet);
 				return;
 			}
 		}
 		else
 		{
 			if (Thirdweb::create_in_app_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
-				TO_RUST_STRING(Email),
+				Arena.Add(Email),
 				nullptr,
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
 				nullptr
 			).AssignResult(Error))
 			{
-				SuccessDelegate.Execute(FInAppWalletHandle(EInAppSource::Email, Error));
+				FInAppWalletHandle Wallet(EInAppSource::Email, Error);
+				Wallet.AuthInput = Email;
+				SuccessDelegate.Execute(Wallet);
 				return;
 			}
 		}
@@ -132,21 +143,22 @@ void FInAppWalletHandle::CreateEmailWallet(const FString& Email, const FCreateIn
 void FInAppWalletHandle::CreateOAuthWallet(const EThirdwebOAuthProvider Provider, const FCreateInAppWalletDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
 {
 	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate)
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Provider, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [Provider, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
 			if (Thirdweb::create_ecosystem_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetEcosystemId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetPartnerId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetEcosystemId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetPartnerId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
 				nullptr,
 				nullptr,
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
-				TO_RUST_STRING(ThirdwebUtils::ToString(Provider))
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(ThirdwebUtils::ToString(Provider))
 			).AssignResult(Error))
 			{
 				SuccessDelegate.Execute(FInAppWalletHandle(Provider, Error));
@@ -156,13 +168,13 @@ void FInAppWalletHandle::CreateOAuthWallet(const EThirdwebOAuthProvider Provider
 		else
 		{
 			if (Thirdweb::create_in_app_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
 				nullptr,
 				nullptr,
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
-				TO_RUST_STRING(ThirdwebUtils::ToString(Provider))
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(ThirdwebUtils::ToString(Provider))
 			).AssignResult(Error))
 			{
 				SuccessDelegate.Execute(FInAppWalletHandle(Provider, Error));
@@ -176,40 +188,45 @@ void FInAppWalletHandle::CreateOAuthWallet(const EThirdwebOAuthProvider Provider
 void FInAppWalletHandle::CreatePhoneWallet(const FString& Phone, const FCreateInAppWalletDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
 {
 	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate)
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Phone, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [Phone, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
 			if (Thirdweb::create_ecosystem_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetEcosystemId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetPartnerId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetEcosystemId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetPartnerId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
 				nullptr,
-				TO_RUST_STRING(Phone),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(Phone),
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
 				nullptr
 			).AssignResult(Error))
 			{
-				SuccessDelegate.Execute(FInAppWalletHandle(EInAppSource::Phone, Error));
+				FInAppWalletHandle Wallet(EInAppSource::Phone, Error);
+				Wallet.AuthInput = Phone;
+				SuccessDelegate.Execute(Wallet);
 				return;
 			}
 		}
 		else
 		{
 			if (Thirdweb::create_in_app_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
 				nullptr,
-				TO_RUST_STRING(Phone),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(Phone),
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
 				nullptr
 			).AssignResult(Error))
 			{
-				SuccessDelegate.Execute(FInAppWalletHandle(EInAppSource::Phone, Error));
+				FInAppWalletHandle Wallet(EInAppSource::Phone, Error);
+				Wallet.AuthInput = Phone;
+				SuccessDelegate.Execute(Wallet);
 				return;
 			}
 		}
@@ -220,22 +237,23 @@ void FInAppWalletHandle::CreatePhoneWallet(const FString& Phone, const FCreateIn
 void FInAppWalletHandle::CreateSiweWallet(const FCreateInAppWalletDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
 {
 	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate)
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		static FString Provider = TEXT("SIWE");
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
 			if (Thirdweb::create_ecosystem_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetEcosystemId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetPartnerId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetEcosystemId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetPartnerId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
 				nullptr,
 				nullptr,
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
-				TO_RUST_STRING(Provider)
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(Provider)
 			).AssignResult(Error))
 			{
 				SuccessDelegate.Execute(FInAppWalletHandle(Siwe, Error));
@@ -245,13 +263,13 @@ void FInAppWalletHandle::CreateSiweWallet(const FCreateInAppWalletDelegate& Succ
 		else
 		{
 			if (Thirdweb::create_in_app_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
 				nullptr,
 				nullptr,
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
-				TO_RUST_STRING(Provider)
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(Provider)
 			).AssignResult(Error))
 			{
 				SuccessDelegate.Execute(FInAppWalletHandle(Siwe, Error));
@@ -273,21 +291,22 @@ void FInAppWalletHandle::CreateCustomAuthWallet(const EInAppSource Source, const
 		}
 		return;
 	}
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [Source, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [Source, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
 			if (Thirdweb::create_ecosystem_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetEcosystemId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetPartnerId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetEcosystemId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetPartnerId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
 				nullptr,
 				nullptr,
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
-				TO_RUST_STRING(FString(GetSourceString(Source)))
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(FString(GetSourceString(Source)))
 			).AssignResult(Error))
 			{
 				SuccessDelegate.Execute(FInAppWalletHandle(Source, Error));
@@ -297,13 +316,13 @@ void FInAppWalletHandle::CreateCustomAuthWallet(const EInAppSource Source, const
 		else
 		{
 			if (Thirdweb::create_in_app_wallet(
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+				Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 				nullptr,
 				nullptr,
 				nullptr,
-				TO_RUST_STRING(UThirdwebRuntimeSettings::GetStorageDirectory()),
-				TO_RUST_STRING(FString(GetSourceString(Source)))
+				Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
+				Arena.Add(FString(GetSourceString(Source)))
 			).AssignResult(Error))
 			{
 				SuccessDelegate.Execute(FInAppWalletHandle(Source, Error));
@@ -314,14 +333,144 @@ void FInAppWalletHandle::CreateCustomAuthWallet(const EInAppSource Source, const
 	});
 }
 
+bool FInAppWalletHandle::CreateNativeWallet(const EInAppSource InSource, const EThirdwebOAuthProvider InProvider, const FString& InAuthInput, FString& Result)
+{
+	FThirdwebUtf8Arena Arena;
+	const char* Email = InSource == EInAppSource::Email ? Arena.Add(InAuthInput) : nullptr;
+	const char* Phone = InSource == EInAppSource::Phone ? Arena.Add(InAuthInput) : nullptr;
+	const char* AuthOption = InSource == OAuthProvider
+		                         ? Arena.Add(ThirdwebUtils::ToString(InProvider))
+		                         : InSource == EInAppSource::Email || InSource == EInAppSource::Phone
+		                         ? nullptr
+		                         : Arena.Add(FString(GetSourceString(InSource)));
+	if (UThirdwebRuntimeSettings::IsEcosystem())
+	{
+		return Thirdweb::create_ecosystem_wallet(
+			Arena.Add(UThirdwebRuntimeSettings::GetEcosystemId()),
+			Arena.Add(UThirdwebRuntimeSettings::GetPartnerId()),
+			Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+			Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
+			nullptr,
+			Email,
+			Phone,
+			Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
+			AuthOption
+		).AssignResult(Result);
+	}
+	return Thirdweb::create_in_app_wallet(
+		Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+		Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
+		nullptr,
+		Email,
+		Phone,
+		Arena.Add(UThirdwebRuntimeSettings::GetStorageDirectory()),
+		AuthOption
+	).AssignResult(Result);
+}
+
+void FInAppWalletHandle::WarmStart(const FCreateInAppWalletDelegate& SuccessDelegate, const FBoolDelegate& RevalidatedDelegate, const FStringDelegate& ErrorDelegate)
+{
+	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate)
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [SuccessDelegate, RevalidatedDelegate, ErrorDelegate]
+	{
+		FThirdwebWalletSessionRecord Record;
+		if (!FThirdwebWalletSessionRecord::Load(Record))
+		{
+			ErrorDelegate.Execute(TEXT("No session to restore"));
+			return;
+		}
+		const EInAppSource RecordSource = static_cast<EInAppSource>(Record.Source);
+		const EThirdwebOAuthProvider RecordProvider = static_cast<EThirdwebOAuthProvider>(Record.Provider);
+		FString Error;
+		if (!CreateNativeWallet(RecordSource, RecordProvider, Record.AuthInput, Error))
+		{
+			ErrorDelegate.Execute(Error);
+			return;
+		}
+		FInAppWalletHandle Wallet = RecordSource == OAuthProvider ? FInAppWalletHandle(RecordProvider, Error) : FInAppWalletHandle(RecordSource, Error);
+		Wallet.AuthInput = Record.AuthInput;
+		const uint32 Generation = Wallet.Metadata ? Wallet.Metadata->GetGeneration() : 0;
+		if (Wallet.Metadata)
+		{
+			Wallet.Metadata->SetAddress(Record.Address, Generation);
+			Wallet.Metadata->SetConnected(Generation);
+		}
+		TW_LOG(Verbose, TEXT("FInAppWalletHandle::WarmStart::%s::%s"), *Wallet.GetDisplayName(), *Record.Address)
+		SuccessDelegate.Execute(Wallet);
+
+		FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Background, [Wallet, Address = Record.Address, Generation, RevalidatedDelegate]
+		{
+			FString CurrentAddress;
+			const bool bValid = Thirdweb::is_connected(Wallet.GetID()).GetBool()
+				&& Thirdweb::get_wallet_address(Wallet.GetID()).AssignResult(CurrentAddress)
+				&& CurrentAddress.Equals(Address, ESearchCase::IgnoreCase);
+			if (!bValid)
+			{
+				TW_LOG(Verbose, TEXT("FInAppWalletHandle::WarmStart::%s::Session expired"), *Wallet.GetDisplayName())
+				// Unless the wallet signed in again meanwhile, what was restored no longer holds
+				if (Wallet.Metadata && Wallet.Metadata->GetGeneration() == Generation)
+				{
+					Wallet.Metadata->Invalidate();
+					FThirdwebWalletSessionRecord::Clear();
+				}
+			}
+			EXECUTE_IF_BOUND(RevalidatedDelegate, bValid)
+		});
+	});
+}
+
+void FInAppWalletHandle::SaveSession() const
+{
+	if (IsRunningDedicatedServer())
+	{
+		// A server signs in on behalf of many players, none of whom is the one to restore
+		return;
+	}
+	if (Metadata)
+	{
+		// A fresh sign in replaces whatever was known of the wallet before
+		Metadata->Invalidate();
+		Metadata->SetConnected(Metadata->GetGeneration());
+	}
+	FThirdwebWalletSessionRecord Record;
+	Record.Source = static_cast<uint8>(Source);
+	Record.Provider = static_cast<uint8>(Provider);
+	// Only the sources that cannot be created again without it keep the email or phone number
+	if (Source == EInAppSource::Email || Source == EInAppSource::Phone)
+	{
+		Record.AuthInput = AuthInput;
+	}
+	Record.Address = ToAddress();
+	if (Record.Address != ThirdwebUtils::ZeroAddress)
+	{
+		Record.Save();
+	}
+}
+
 bool FInAppWalletHandle::IsConnected() const
 {
-	return Thirdweb::is_connected(ID).GetOutput().ToBool();
+	if (Metadata && Metadata->IsConnected())
+	{
+		return true;
+	}
+	const uint32 Generation = Metadata ? Metadata->GetGeneration() : 0;
+	const bool bConnected = Thirdweb::is_connected(ID).GetBool();
+	if (bConnected && Metadata)
+	{
+		Metadata->SetConnected(Generation);
+	}
+	return bConnected;
 }
 
 void FInAppWalletHandle::Disconnect() const
 {
+	const FString Address = ToAddress();
 	Thirdweb::disconnect(ID).Free();
+	FThirdwebWalletMetadataCache::Get().Invalidate(ID);
+	if (FThirdwebWalletSessionRecord Record; FThirdwebWalletSessionRecord::Load(Record) && Record.Address.Equals(Address, ESearchCase::IgnoreCase))
+	{
+		FThirdwebWalletSessionRecord::Clear();
+	}
 }
 
 void FInAppWalletHandle::SendOTP(const FStreamableDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
@@ -329,7 +478,7 @@ void FInAppWalletHandle::SendOTP(const FStreamableDelegate& SuccessDelegate, con
 	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate)
 	CHECK_VALIDITY(ErrorDelegate)
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, SuccessDelegate, ErrorDelegate]
 	{
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
@@ -404,8 +553,9 @@ void FInAppWalletHandle::SignInWithOTP(const FString& OTP, const FStreamableDele
 		return;
 	}
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, OTP, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, OTP, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
@@ -413,8 +563,9 @@ void FInAppWalletHandle::SignInWithOTP(const FString& OTP, const FStreamableDele
 			{
 			case Phone:
 				{
-					if (Thirdweb::ecosystem_wallet_sign_in_with_otp_phone(ThisCopy.GetID(), TO_RUST_STRING(OTP)).AssignResult(Error, true))
+					if (Thirdweb::ecosystem_wallet_sign_in_with_otp_phone(ThisCopy.GetID(), Arena.Add(OTP)).AssignResult(Error, true))
 					{
+						ThisCopy.SaveSession();
 						ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 						SuccessDelegate.Execute();
 						return;
@@ -423,8 +574,9 @@ void FInAppWalletHandle::SignInWithOTP(const FString& OTP, const FStreamableDele
 				}
 			case Email:
 				{
-					if (Thirdweb::ecosystem_wallet_sign_in_with_otp_email(ThisCopy.GetID(), TO_RUST_STRING(OTP)).AssignResult(Error, true))
+					if (Thirdweb::ecosystem_wallet_sign_in_with_otp_email(ThisCopy.GetID(), Arena.Add(OTP)).AssignResult(Error, true))
 					{
+						ThisCopy.SaveSession();
 						ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 						SuccessDelegate.Execute();
 						return;
@@ -440,8 +592,9 @@ void FInAppWalletHandle::SignInWithOTP(const FString& OTP, const FStreamableDele
 			{
 			case Phone:
 				{
-					if (Thirdweb::in_app_wallet_sign_in_with_otp_phone(ThisCopy.GetID(), TO_RUST_STRING(OTP)).AssignResult(Error, true))
+					if (Thirdweb::in_app_wallet_sign_in_with_otp_phone(ThisCopy.GetID(), Arena.Add(OTP)).AssignResult(Error, true))
 					{
+						ThisCopy.SaveSession();
 						ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 						SuccessDelegate.Execute();
 						return;
@@ -449,8 +602,9 @@ void FInAppWalletHandle::SignInWithOTP(const FString& OTP, const FStreamableDele
 				}
 			case Email:
 				{
-					if (Thirdweb::in_app_wallet_sign_in_with_otp_email(ThisCopy.GetID(), TO_RUST_STRING(OTP)).AssignResult(Error, true))
+					if (Thirdweb::in_app_wallet_sign_in_with_otp_email(ThisCopy.GetID(), Arena.Add(OTP)).AssignResult(Error, true))
 					{
+						ThisCopy.SaveSession();
 						ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 						SuccessDelegate.Execute();
 						return;
@@ -474,14 +628,15 @@ void FInAppWalletHandle::LinkOTP(const FInAppWalletHandle& Wallet, const FString
 		return;
 	}
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Wallet, OTP, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Wallet, OTP, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		switch (ThisCopy.GetSource())
 		{
 		case Phone:
 			{
-				if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), TO_RUST_STRING(OTP), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr).AssignResult(Error, true))
+				if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), Arena.Add(OTP), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr).AssignResult(Error, true))
 				{
 					SuccessDelegate.Execute();
 					return;
@@ -490,7 +645,7 @@ void FInAppWalletHandle::LinkOTP(const FInAppWalletHandle& Wallet, const FString
 			}
 		case Email:
 			{
-				if (Thirdweb::ecosystem_wallet_sign_in_with_otp_email(ThisCopy.GetID(), TO_RUST_STRING(OTP)).AssignResult(Error, true))
+				if (Thirdweb::ecosystem_wallet_sign_in_with_otp_email(ThisCopy.GetID(), Arena.Add(OTP)).AssignResult(Error, true))
 				{
 					SuccessDelegate.Execute();
 					return;
@@ -551,14 +706,16 @@ void FInAppWalletHandle::SignInWithOAuth(const FString& AuthResult, const FStrea
 	}
 	FString Result = ThirdwebUtils::ParseAuthResult(AuthResult);
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Result, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Result, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
 			TW_LOG(VeryVerbose, TEXT("FInAppWalletHandle::SignInWithOAuth::Task::%s"), *Result)
-			if (Thirdweb::ecosystem_wallet_sign_in_with_oauth(ThisCopy.GetID(), TO_RUST_STRING(Result)).AssignResult(Error, true))
+			if (Thirdweb::ecosystem_wallet_sign_in_with_oauth(ThisCopy.GetID(), Arena.Add(Result)).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -566,8 +723,9 @@ void FInAppWalletHandle::SignInWithOAuth(const FString& AuthResult, const FStrea
 		}
 		else
 		{
-			if (Thirdweb::in_app_wallet_sign_in_with_oauth(ThisCopy.GetID(), TO_RUST_STRING(Result)).AssignResult(Error, true))
+			if (Thirdweb::in_app_wallet_sign_in_with_oauth(ThisCopy.GetID(), Arena.Add(Result)).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -586,10 +744,11 @@ void FInAppWalletHandle::LinkOAuth(const FInAppWalletHandle& Wallet, const FStri
 
 	FString Result = ThirdwebUtils::ParseAuthResult(AuthResult);
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Wallet, Result, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Wallet, Result, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
-		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, TO_RUST_STRING(Result), nullptr, nullptr, nullptr, nullptr, nullptr).AssignResult(Error, true))
+		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, Arena.Add(Result), nullptr, nullptr, nullptr, nullptr, nullptr).AssignResult(Error, true))
 		{
 			SuccessDelegate.Execute();
 			return;
@@ -605,13 +764,15 @@ void FInAppWalletHandle::SignInWithJwt(const FString& Jwt, const FStreamableDele
 	CHECK_SOURCE(EInAppSource::Jwt, ErrorDelegate)
 
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Jwt, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Jwt, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
-			if (Thirdweb::ecosystem_wallet_sign_in_with_jwt(ThisCopy.GetID(), TO_RUST_STRING(Jwt)).AssignResult(Error, true))
+			if (Thirdweb::ecosystem_wallet_sign_in_with_jwt(ThisCopy.GetID(), Arena.Add(Jwt)).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -624,8 +785,9 @@ void FInAppWalletHandle::SignInWithJwt(const FString& Jwt, const FStreamableDele
 				ErrorDelegate.Execute(TEXT("No encryption key set"));
 				return;
 			}
-			if (Thirdweb::in_app_wallet_sign_in_with_jwt(ThisCopy.GetID(), TO_RUST_STRING(Jwt), TO_RUST_STRING(UThirdwebRuntimeSettings::GetEncryptionKey())).AssignResult(Error, true))
+			if (Thirdweb::in_app_wallet_sign_in_with_jwt(ThisCopy.GetID(), Arena.Add(Jwt), Arena.Add(UThirdwebRuntimeSettings::GetEncryptionKey())).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -643,10 +805,11 @@ void FInAppWalletHandle::LinkJwt(const FInAppWalletHandle& Wallet, const FString
 	CHECK_WALLET_SOURCE(Wallet, EInAppSource::Jwt, ErrorDelegate)
 
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Wallet, Jwt, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Wallet, Jwt, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
-		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, nullptr, TO_RUST_STRING(Jwt), nullptr, nullptr, nullptr, nullptr).AssignResult(Error, true))
+		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, nullptr, Arena.Add(Jwt), nullptr, nullptr, nullptr, nullptr).AssignResult(Error, true))
 		{
 			SuccessDelegate.Execute();
 			return;
@@ -662,13 +825,15 @@ void FInAppWalletHandle::SignInWithAuthEndpoint(const FString& Payload, const FS
 	CHECK_SOURCE(AuthEndpoint, ErrorDelegate)
 
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Payload, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Payload, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
-			if (Thirdweb::ecosystem_wallet_sign_in_with_auth_endpoint(ThisCopy.GetID(), TO_RUST_STRING(Payload)).AssignResult(Error, true))
+			if (Thirdweb::ecosystem_wallet_sign_in_with_auth_endpoint(ThisCopy.GetID(), Arena.Add(Payload)).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -681,8 +846,9 @@ void FInAppWalletHandle::SignInWithAuthEndpoint(const FString& Payload, const FS
 				ErrorDelegate.Execute(TEXT("No encryption key set"));
 				return;
 			}
-			if (Thirdweb::in_app_wallet_sign_in_with_auth_endpoint(ThisCopy.GetID(), TO_RUST_STRING(Payload), TO_RUST_STRING(UThirdwebRuntimeSettings::GetEncryptionKey())).AssignResult(Error, true))
+			if (Thirdweb::in_app_wallet_sign_in_with_auth_endpoint(ThisCopy.GetID(), Arena.Add(Payload), Arena.Add(UThirdwebRuntimeSettings::GetEncryptionKey())).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -700,10 +866,11 @@ void FInAppWalletHandle::LinkAuthEndpoint(const FInAppWalletHandle& Wallet, cons
 	CHECK_WALLET_SOURCE(Wallet, AuthEndpoint, ErrorDelegate)
 
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Wallet, Payload, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Wallet, Payload, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
-		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, nullptr, nullptr, TO_RUST_STRING(Payload), nullptr, nullptr, nullptr).AssignResult(Error, true))
+		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, nullptr, nullptr, Arena.Add(Payload), nullptr, nullptr, nullptr).AssignResult(Error, true))
 		{
 			SuccessDelegate.Execute();
 			return;
@@ -719,13 +886,15 @@ void FInAppWalletHandle::SignInWithGuest(const FStreamableDelegate& SuccessDeleg
 	CHECK_SOURCE(Guest, ErrorDelegate)
 
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
-			if (Thirdweb::ecosystem_wallet_sign_in_with_guest(ThisCopy.GetID(), TO_RUST_STRING(FPlatformMisc::GetLoginId())).AssignResult(Error, true))
+			if (Thirdweb::ecosystem_wallet_sign_in_with_guest(ThisCopy.GetID(), Arena.Add(FPlatformMisc::GetLoginId())).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -733,8 +902,9 @@ void FInAppWalletHandle::SignInWithGuest(const FStreamableDelegate& SuccessDeleg
 		}
 		else
 		{
-			if (Thirdweb::in_app_wallet_sign_in_with_guest(ThisCopy.GetID(), TO_RUST_STRING(FPlatformMisc::GetLoginId())).AssignResult(Error, true))
+			if (Thirdweb::in_app_wallet_sign_in_with_guest(ThisCopy.GetID(), Arena.Add(FPlatformMisc::GetLoginId())).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -752,10 +922,11 @@ void FInAppWalletHandle::LinkGuest(const FInAppWalletHandle& Wallet, const FStre
 	CHECK_WALLET_SOURCE(Wallet, Guest, ErrorDelegate)
 
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Wallet, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Wallet, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
-		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, nullptr, nullptr, nullptr, TO_RUST_STRING(FPlatformMisc::GetLoginId()), nullptr, nullptr).
+		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, nullptr, nullptr, nullptr, Arena.Add(FPlatformMisc::GetLoginId()), nullptr, nullptr).
 			AssignResult(Error, true))
 		{
 			SuccessDelegate.Execute();
@@ -772,14 +943,16 @@ void FInAppWalletHandle::SignInWithEthereum(const FString& Payload, const FStrin
 	CHECK_SOURCE(Siwe, ErrorDelegate)
 
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Payload, Signature, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Payload, Signature, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		UE_LOG(LogTemp, VeryVerbose, TEXT("FInAppWalletHandle::SignInWithEthereum::Task::WalletHandle=%lld | Signature=%s | Payload=%s"), ThisCopy.GetID(), *Signature, *Payload);
 		FString Error;
 		if (UThirdwebRuntimeSettings::IsEcosystem())
 		{
-			if (Thirdweb::ecosystem_wallet_sign_in_with_siwe(ThisCopy.GetID(), TO_RUST_STRING(Payload), TO_RUST_STRING(Signature)).AssignResult(Error, true))
+			if (Thirdweb::ecosystem_wallet_sign_in_with_siwe(ThisCopy.GetID(), Arena.Add(Payload), Arena.Add(Signature)).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -787,8 +960,9 @@ void FInAppWalletHandle::SignInWithEthereum(const FString& Payload, const FStrin
 		}
 		else
 		{
-			if (Thirdweb::in_app_wallet_sign_in_with_siwe(ThisCopy.GetID(), TO_RUST_STRING(Payload), TO_RUST_STRING(Signature)).AssignResult(Error, true))
+			if (Thirdweb::in_app_wallet_sign_in_with_siwe(ThisCopy.GetID(), Arena.Add(Payload), Arena.Add(Signature)).AssignResult(Error, true))
 			{
+				ThisCopy.SaveSession();
 				ThirdwebUtils::Internal::SendConnectEvent(ThisCopy);
 				SuccessDelegate.Execute();
 				return;
@@ -806,10 +980,11 @@ void FInAppWalletHandle::LinkSiwe(const FInAppWalletHandle& Wallet, const FStrin
 	CHECK_WALLET_SOURCE(Wallet, Siwe, ErrorDelegate)
 
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Wallet, Payload, Signature, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [ThisCopy, Wallet, Payload, Signature, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		FString Error;
-		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, nullptr, nullptr, nullptr, nullptr, TO_RUST_STRING(Signature), TO_RUST_STRING(Payload)).
+		if (Thirdweb::ecosystem_wallet_link_account(ThisCopy.GetID(), Wallet.GetID(), nullptr, nullptr, nullptr, nullptr, nullptr, Arena.Add(Signature), Arena.Add(Payload)).
 			AssignResult(Error, true))
 		{
 			SuccessDelegate.Execute();
@@ -826,7 +1001,7 @@ void FInAppWalletHandle::GetLinkedAccounts(const FGetLinkedAccountsDelegate& Suc
 	CHECK_ECOSYSTEM(ErrorDelegate)
 
 	FInAppWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Background, [ThisCopy, SuccessDelegate, ErrorDelegate]
 	{
 		FString Output;
 		if (Thirdweb::ecosystem_wallet_get_linked_accounts(ThisCopy.GetID()).AssignResult(Output))
@@ -10,6 +10,7 @@
 #include "ThirdwebUtils.h"
 
 #include "Containers/ThirdwebSigner.h"
+#include "Containers/ThirdwebWalletBootstrapResult.h"
 
 #include "Dom/JsonObject.h"
 
@@ -22,7 +23,10 @@
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
-#include "Tasks/Task.h"
+#include "Internal/ThirdwebFFIExecutor.h"
+#include "Internal/ThirdwebJsonReader.h"
+#include "Internal/ThirdwebUtf8Arena.h"
+#include "Internal/ThirdwebWalletMetadataCache.h"
 
 FSmartWalletHandle::FSmartWalletHandle(const FInAppWalletHandle& InInAppWallet, const FString& Int64String)
 {
@@ -32,6 +36,7 @@ FSmartWalletHandle::FSmartWalletHandle(const FInAppWalletHandle& InInAppWallet,
 	FDefaultValueHelper::ParseInt64(Int64String, InID);
 	ensureAlwaysMsgf(InID > 0, TEXT("Invalid id 0"));
 	ID = InID;
+	BindMetadata();
 }
 
 void FSmartWalletHandle::Create(const FInAppWalletHandle& InInAppWallet,
@@ -41,6 +46,18 @@ void FSmartWalletHandle::Create(const FInAppWalletHandle& InInAppWallet,
                                 const FString& AccountOverride,
                                 const FCreateSmartWalletDelegate& SuccessDelegate,
                                 const FStringDelegate& ErrorDelegate)
+{
+	Create(EThirdwebFFIPriority::Normal, InInAppWallet, ChainID, bGasless, Factory, AccountOverride, SuccessDelegate, ErrorDelegate);
+}
+
+void FSmartWalletHandle::Create(const EThirdwebFFIPriority Priority,
+                                const FInAppWalletHandle& InInAppWallet,
+                                const int64 ChainID,
+                                const bool bGasless,
+                                const FString& Factory,
+                                const FString& AccountOverride,
+                                const FCreateSmartWalletDelegate& SuccessDelegate,
+                                const FStringDelegate& ErrorDelegate)
 {
 	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate);
 	
@@ -53,20 +70,22 @@ void FSmartWalletHandle::Create(const FInAppWalletHandle& InInAppWallet,
 		return;
 	}
 	
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [InInAppWallet, ChainID, bGasless, Factory, AccountOverride, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(Priority, [InInAppWallet, ChainID, bGasless, Factory, AccountOverride, SuccessDelegate, ErrorDelegate]
 	{
+		FThirdwebUtf8Arena Arena;
 		if (FString Error; Thirdweb::create_smart_wallet(
-			TO_RUST_STRING(UThirdwebRuntimeSettings::GetClientId()),
-			TO_RUST_STRING(UThirdwebRuntimeSettings::GetBundleId()),
+			Arena.Add(UThirdwebRuntimeSettings::GetClientId()),
+			Arena.Add(UThirdwebRuntimeSettings::GetBundleId()),
 			nullptr,
 			InInAppWallet.GetID(),
-			TO_RUST_STRING(FString::Printf(TEXT("%lld"), ChainID)),
+			Arena.Add(FString::Printf(TEXT("%lld"), ChainID)),
 			bGasless,
-			TO_RUST_STRING(Factory),
-			TO_RUST_STRING(AccountOverride)
+			Arena.Add(Factory),
+			Arena.Add(AccountOverride)
 		).AssignResult(Error))
 		{
 			const FSmartWalletHandle SmartWallet = FSmartWalletHandle(InInAppWallet, Error);
+			FThirdwebWalletMetadataCache::Get().Link(InInAppWallet.GetID(), SmartWallet.GetID());
 			SuccessDelegate.Execute(SmartWallet);
 			ThirdwebUtils::Internal::SendConnectEvent(SmartWallet);
 		}
@@ -80,17 +99,177 @@ void FSmartWalletHandle::Create(const FInAppWalletHandle& InInAppWallet,
 	});
 }
 
+void FSmartWalletHandle::Bootstrap(const FInAppWalletHandle& InInAppWallet,
+                                   const int64 ChainID,
+                                   const bool bGasless,
+                                   const FString& Factory,
+                                   const FString& AccountOverride,
+                                   const FBootstrapDelegate& SuccessDelegate,
+                                   const FStringDelegate& ErrorDelegate)
+{
+	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate);
+
+	struct FState
+	{
+		FCriticalSection Lock;
+		FThirdwebWalletBootstrapResult Result;
+		FString Error;
+		double StartedAt = FPlatformTime::Seconds();
+		// The in-app address, the creation and the three stages following it
+		std::atomic<int32> Remaining{5};
+		FBootstrapDelegate SuccessDelegate;
+		FStringDelegate ErrorDelegate;
+
+		static float Since(const double Start) { return static_cast<float>((FPlatformTime::Seconds() - Start) * 1000.0); }
+
+		void Fail(const FString& InError)
+		{
+			FScopeLock ScopeLock(&Lock);
+			if (Error.IsEmpty())
+			{
+				Error = InError;
+			}
+		}
+
+		void Complete(const int32 Stages = 1)
+		{
+			if (Remaining.fetch_sub(Stages) != Stages)
+			{
+				return;
+			}
+			Result.Timings.Total = Since(StartedAt);
+			if (Error.IsEmpty())
+			{
+				TW_LOG(Verbose, TEXT("FSmartWalletHandle::Bootstrap::%s::Total=%.1fms::Create=%.1fms"), *Result.SmartWallet.GetDisplayName(), Result.Timings.Total, Result.Timings.CreateSmartWallet)
+				SuccessDelegate.Execute(Result);
+			}
+			else
+			{
+				ErrorDelegate.Execute(Error);
+			}
+		}
+	};
+	const TSharedRef<FState, ESPMode::ThreadSafe> State = MakeShared<FState, ESPMode::ThreadSafe>();
+	State->SuccessDelegate = SuccessDelegate;
+	State->ErrorDelegate = ErrorDelegate;
+
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [State, InInAppWallet]
+	{
+		const double Start = FPlatformTime::Seconds();
+		const FString Address = InInAppWallet.ToAddress();
+		{
+			FScopeLock ScopeLock(&State->Lock);
+			State->Result.InAppAddress = Address;
+			State->Result.Timings.InAppAddress = FState::Since(Start);
+		}
+		State->Complete();
+	});
+
+	Create(
+		EThirdwebFFIPriority::Interactive,
+		InInAppWallet,
+		ChainID,
+		bGasless,
+		Factory,
+		AccountOverride,
+		FCreateSmartWalletDelegate::CreateLambda([State](const FSmartWalletHandle& SmartWallet)
+		{
+			const double CreatedAt = FPlatformTime::Seconds();
+			{
+				FScopeLock ScopeLock(&State->Lock);
+				State->Result.SmartWallet = SmartWallet;
+				State->Result.Timings.CreateSmartWallet = FState::Since(State->StartedAt);
+			}
+			FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [State, SmartWallet, CreatedAt]
+			{
+				const FString Address = SmartWallet.ToAddress();
+				if (Address == ThirdwebUtils::ZeroAddress)
+				{
+					State->Fail(TEXT("Could not get the smart wallet address"));
+				}
+				{
+					FScopeLock ScopeLock(&State->Lock);
+					State->Result.SmartWalletAddress = Address;
+					State->Result.Timings.SmartWalletAddress = FState::Since(CreatedAt);
+				}
+				State->Complete();
+			});
+			FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [State, SmartWallet, CreatedAt]
+			{
+				if (FString Error; Thirdweb::smart_wallet_is_deployed(SmartWallet.GetID()).AssignResult(Error))
+				{
+					const bool bDeployed = Error.ToBool();
+					if (FThirdwebSmartWalletPermissions* Permissions = SmartWallet.GetPermissions(); Permissions && bDeployed)
+					{
+						Permissions->SetDeployed();
+					}
+					FScopeLock ScopeLock(&State->Lock);
+					State->Result.bDeployed = bDeployed;
+					State->Result.Timings.DeployCheck = FState::Since(CreatedAt);
+				}
+				else
+				{
+					State->Fail(Error);
+				}
+				State->Complete();
+			});
+			FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Interactive, [State, SmartWallet, CreatedAt]
+			{
+				FThirdwebSmartWalletPermissions* Permissions = SmartWallet.GetPermissions();
+				const uint32 Generation = Permissions ? Permissions->GetGeneration() : 0;
+				TArray<FSigner> Signers;
+				const auto ReadSigners = [&Signers](FThirdwebJsonReader& Reader) { Signers = Reader.ReadObjectArray<FSigner>(); };
+				if (FString Error; Thirdweb::smart_wallet_get_all_active_signers(SmartWallet.GetID()).ReadJson(ReadSigners, Error))
+				{
+					if (Permissions)
+					{
+						Permissions->SetActiveSigners(Signers, Generation);
+					}
+				}
+				else
+				{
+					// Expected of an account that is not deployed yet, so the bootstrap goes on without signers
+					TW_LOG(Verbose, TEXT("FSmartWalletHandle::Bootstrap::ActiveSigners::%s"), *Error)
+				}
+				{
+					FScopeLock ScopeLock(&State->Lock);
+					State->Result.ActiveSigners = MoveTemp(Signers);
+					State->Result.Timings.ActiveSigners = FState::Since(CreatedAt);
+				}
+				State->Complete();
+			});
+			// The creation stage itself
+			State->Complete();
+		}),
+		FStringDelegate::CreateLambda([State](const FString& Error)
+		{
+			State->Fail(Error);
+			State->Complete(4);
+		})
+	);
+}
+
 void FSmartWalletHandle::IsDeployed(const FBoolDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
 {
 	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate);
 	CHECK_VALIDITY(ErrorDelegate);
 	
+	if (const FThirdwebSmartWalletPermissions* Permissions = GetPermissions(); Permissions && Permissions->IsDeployed())
+	{
+		SuccessDelegate.Execute(true);
+		return;
+	}
 	FSmartWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Background, [ThisCopy, SuccessDelegate, ErrorDelegate]
 	{
 		if (FString Error; Thirdweb::smart_wallet_is_deployed(ThisCopy.GetID()).AssignResult(Error))
 		{
-			SuccessDelegate.Execute(Error.ToBool());
+			const bool bDeployed = Error.ToBool();
+			if (FThirdwebSmartWalletPermissions* Permissions = ThisCopy.GetPermissions(); Permissions && bDeployed)
+			{
+				Permissions->SetDeployed();
+			}
+			SuccessDelegate.Execute(bDeployed);
 		}
 		else
 		{
@@ -111,11 +290,6 @@ void FSmartWalletHandle::CreateSessionKey(const FString& Signer,
 	
 	FDateTime TenYearsFromNow = FDateTime::UtcNow() + FTimespan::FromDays(10 * 365);
 	FDateTime EndTime = TenYearsFromNow;
-	TArray<const char*> ApprovedTargetsCArray;
-	for (const FString& Target : ApprovedTargets)
-	{
-		ApprovedTargetsCArray.Add(TO_RUST_STRING(Target));
-	}
 	if (PermissionEnd.ToUnixTimestamp() > 0)
 	{
 		EndTime = PermissionEnd;
@@ -126,23 +300,28 @@ void FSmartWalletHandle::CreateSessionKey(const FString& Signer,
 		}
 	}
 	FSmartWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(
-		UE_SOURCE_LOCATION,
-		[ThisCopy, Signer, ApprovedTargets, ApprovedTargetsCArray, NativeTokenLimitPerTransactionInWei, EndTime, TenYearsFromNow, SuccessDelegate,
+	FThirdwebFFIExecutor::Launch(
+		EThirdwebFFIPriority::Normal,
+		[ThisCopy, Signer, ApprovedTargets, NativeTokenLimitPerTransactionInWei, EndTime, TenYearsFromNow, SuccessDelegate,
 			ErrorDelegate]
 		{
+			FThirdwebUtf8Arena Arena;
 			if (FString Error; Thirdweb::smart_wallet_create_session_key(
 				ThisCopy.GetID(),
-				TO_RUST_STRING(Signer),
-				ApprovedTargets.IsEmpty() ? nullptr : ApprovedTargetsCArray.GetData(),
-				ApprovedTargetsCArray.Num(),
-				TO_RUST_STRING(NativeTokenLimitPerTransactionInWei),
+				Arena.Add(Signer),
+				Arena.Add(ApprovedTargets),
+				ApprovedTargets.Num(),
+				Arena.Add(NativeTokenLimitPerTransactionInWei),
 				0,
 				TO_RUST_TIMESTAMP(EndTime),
 				0,
 				TO_RUST_TIMESTAMP(TenYearsFromNow)
 			).AssignResult(Error))
 			{
+				if (FThirdwebSmartWalletPermissions* Permissions = ThisCopy.GetPermissions())
+				{
+					Permissions->InvalidateSigners();
+				}
 				TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
 				const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Error);
 				if (FJsonSerializer::Deserialize(Reader, JsonObject); JsonObject.IsValid())
@@ -169,10 +348,15 @@ void FSmartWalletHandle::RevokeSessionKey(const FString& Signer, const FSimpleDe
 	CHECK_VALIDITY(ErrorDelegate);
 	
 	FSmartWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Signer, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Normal, [ThisCopy, Signer, SuccessDelegate, ErrorDelegate]
 	{
-		if (FString Error; Thirdweb::smart_wallet_revoke_session_key(ThisCopy.GetID(), TO_RUST_STRING(Signer)).AssignResult(Error))
+		FThirdwebUtf8Arena Arena;
+		if (FString Error; Thirdweb::smart_wallet_revoke_session_key(ThisCopy.GetID(), Arena.Add(Signer)).AssignResult(Error))
 		{
+			if (FThirdwebSmartWalletPermissions* Permissions = ThisCopy.GetPermissions())
+			{
+				Permissions->InvalidateSigners();
+			}
 			SuccessDelegate.Execute();
 		}
 		else
@@ -187,21 +371,35 @@ void FSmartWalletHandle::GetAdmins(const FStringArrayDelegate& SuccessDelegate,
 	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate);
 	CHECK_VALIDITY(ErrorDelegate);
 	
+	FThirdwebSmartWalletPermissions* Permissions = GetPermissions();
+	if (Permissions)
+	{
+		if (TOptional<TArray<FString>> Admins = Permissions->GetAdmins())
+		{
+			SuccessDelegate.Execute(*Admins);
+			return;
+		}
+	}
+	const uint32 Generation = Permissions ? Permissions->GetGeneration() : 0;
 	FSmartWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Background, [ThisCopy, Generation, SuccessDelegate, ErrorDelegate]
 	{
 		TArray<FString> Admins;
-		if (FString Error; Thirdweb::smart_wallet_get_all_admins(ThisCopy.GetID()).AssignResult(Error))
+		const auto ReadAdmins = [&Admins](FThirdwebJsonReader& Reader)
 		{
-			TArray<TSharedPtr<FJsonValue>> JsonValueArray;
-			const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Error);
-			FJsonSerializer::Deserialize(Reader, JsonValueArray);
-			for (int i = 0; i < JsonValueArray.Num(); i++)
+			Reader.ReadArray([&Reader, &Admins]()
 			{
-				if (JsonValueArray[i]->Type == EJson::String)
+				if (FString Admin; Reader.Read(Admin))
 				{
-					Admins.Emplace(JsonValueArray[i]->AsString());
+					Admins.Emplace(MoveTemp(Admin));
 				}
+			});
+		};
+		if (FString Error; Thirdweb::smart_wallet_get_all_admins(ThisCopy.GetID()).ReadJson(ReadAdmins, Error))
+		{
+			if (FThirdwebSmartWalletPermissions* Permissions = ThisCopy.GetPermissions())
+			{
+				Permissions->SetAdmins(Admins, Generation);
 			}
 			SuccessDelegate.Execute(Admins);
 		}
@@ -221,10 +419,15 @@ void FSmartWalletHandle::AddAdmin(const FString& Signer, const FSimpleDelegate&
 	CHECK_VALIDITY(ErrorDelegate);
 	
 	FSmartWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Signer, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Normal, [ThisCopy, Signer, SuccessDelegate, ErrorDelegate]
 	{
-		if (FString Error; Thirdweb::smart_wallet_add_admin(ThisCopy.GetID(), TO_RUST_STRING(Signer)).AssignResult(Error))
+		FThirdwebUtf8Arena Arena;
+		if (FString Error; Thirdweb::smart_wallet_add_admin(ThisCopy.GetID(), Arena.Add(Signer)).AssignResult(Error))
 		{
+			if (FThirdwebSmartWalletPermissions* Permissions = ThisCopy.GetPermissions())
+			{
+				Permissions->InvalidateAdmins();
+			}
 			SuccessDelegate.Execute();
 		} else
 		{
@@ -239,10 +442,15 @@ void FSmartWalletHandle::RemoveAdmin(const FString& Signer, const FSimpleDelegat
 	CHECK_VALIDITY(ErrorDelegate);
 	
 	FSmartWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Signer, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Normal, [ThisCopy, Signer, SuccessDelegate, ErrorDelegate]
 	{
-		if (FString Error; Thirdweb::smart_wallet_remove_admin(ThisCopy.GetID(), TO_RUST_STRING(Signer)).AssignResult(Error))
+		FThirdwebUtf8Arena Arena;
+		if (FString Error; Thirdweb::smart_wallet_remove_admin(ThisCopy.GetID(), Arena.Add(Signer)).AssignResult(Error))
 		{
+			if (FThirdwebSmartWalletPermissions* Permissions = ThisCopy.GetPermissions())
+			{
+				Permissions->InvalidateAdmins();
+			}
 			SuccessDelegate.Execute();
 		} else
 		{
@@ -256,21 +464,26 @@ void FSmartWalletHandle::GetActiveSigners(const FGetActiveSignersDelegate& Succe
 	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate);
 	CHECK_VALIDITY(ErrorDelegate);
 	
+	FThirdwebSmartWalletPermissions* Permissions = GetPermissions();
+	if (Permissions)
+	{
+		if (TOptional<TArray<FSigner>> Signers = Permissions->GetActiveSigners())
+		{
+			SuccessDelegate.Execute(*Signers);
+			return;
+		}
+	}
+	const uint32 Generation = Permissions ? Permissions->GetGeneration() : 0;
 	FSmartWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Background, [ThisCopy, Generation, SuccessDelegate, ErrorDelegate]
 	{
-		if (FString Error; Thirdweb::smart_wallet_get_all_active_signers(ThisCopy.GetID()).AssignResult(Error))
+		TArray<FSigner> Signers;
+		const auto ReadSigners = [&Signers](FThirdwebJsonReader& Reader) { Signers = Reader.ReadObjectArray<FSigner>(); };
+		if (FString Error; Thirdweb::smart_wallet_get_all_active_signers(ThisCopy.GetID()).ReadJson(ReadSigners, Error))
 		{
-			TArray<FSigner> Signers;
-			TArray<TSharedPtr<FJsonValue>> JsonValueArray;
-			const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Error);
-			FJsonSerializer::Deserialize(Reader, JsonValueArray);
-			for (int i = 0; i < JsonValueArray.Num(); i++)
+			if (FThirdwebSmartWalletPermissions* Permissions = ThisCopy.GetPermissions())
 			{
-				if (JsonValueArray[i]->Type == EJson::Object)
-				{
-					Signers.Emplace(FSigner::FromJson(JsonValueArray[i]->AsObject()));
-				}
+				Permissions->SetActiveSigners(Signers, Generation);
 			}
 			SuccessDelegate.Execute(Signers);
 		}
@@ -280,3 +493,70 @@ void FSmartWalletHandle::GetActiveSigners(const FGetActiveSignersDelegate& Succe
 		}
 	});
 }
+
+void FSmartWalletHandle::IsActiveSigner(const FString& Signer, const FBoolDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate) const
+{
+	CHECK_DELEGATES(SuccessDelegate, ErrorDelegate);
+	CHECK_VALIDITY(ErrorDelegate);
+
+	FThirdwebSmartWalletPermissions* Permissions = GetPermissions();
+	if (Permissions)
+	{
+		if (const TOptional<bool> bActive = Permissions->IsActiveSigner(Signer))
+		{
+			SuccessDelegate.Execute(*bActive);
+			return;
+		}
+	}
+	const uint32 Generation = Permissions ? Permissions->GetGeneration() : 0;
+	FSmartWalletHandle ThisCopy = *this;
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Background, [ThisCopy, Signer, Generation, SuccessDelegate, ErrorDelegate]
+	{
+		FThirdwebSmartWalletPermissions* Permissions = ThisCopy.GetPermissions();
+		if (!Permissions || !Permissions->IsDeployed())
+		{
+			FString Error;
+			if (!Thirdweb::smart_wallet_is_deployed(ThisCopy.GetID()).AssignResult(Error))
+			{
+				ErrorDelegate.Execute(Error);
+				return;
+			}
+			if (!Error.ToBool())
+			{
+				SuccessDelegate.Execute(false);
+				return;
+			}
+			if (Permissions)
+			{
+				Permissions->SetDeployed();
+			}
+		}
+		TArray<FSigner> Signers;
+		const auto ReadSigners = [&Signers](FThirdwebJsonReader& Reader) { Signers = Reader.ReadObjectArray<FSigner>(); };
+		if (FString Error; !Thirdweb::smart_wallet_get_all_active_signers(ThisCopy.GetID()).ReadJson(ReadSigners, Error))
+		{
+			ErrorDelegate.Execute(Error);
+			return;
+		}
+		if (Permissions)
+		{
+			Permissions->SetActiveSigners(Signers, Generation);
+			if (const TOptional<bool> bActive = Permissions->IsActiveSigner(Signer))
+			{
+				SuccessDelegate.Execute(*bActive);
+				return;
+			}
+		}
+		// Not cached, either because there is no cache or it was invalidated meanwhile
+		const FDateTime Now = FDateTime::UtcNow();
+		SuccessDelegate.Execute(Signers.ContainsByPredicate([&Signer, &Now](const FSigner& Active)
+		{
+			return Active.Address.Equals(Signer, ESearchCase::IgnoreCase) && FThirdwebSmartWalletPermissions::IsActiveAt(Active, Now);
+		}));
+	});
+}
+
+FThirdwebSmartWalletPermissions* FSmartWalletHandle::GetPermissions() const
+{
+	return Metadata ? &Metadata->GetPermissions() : nullptr;
+}
@@ -8,7 +8,9 @@
 #include "ThirdwebMacros.h"
 #include "ThirdwebUtils.h"
 
-#include "Tasks/Task.h"
+#include "Internal/ThirdwebFFIExecutor.h"
+#include "Internal/ThirdwebUtf8Arena.h"
+#include "Internal/ThirdwebWalletMetadataCache.h"
 
 #include "Wallets/ThirdwebSmartWalletHandle.h"
 
@@ -16,32 +18,58 @@ FWalletHandle::FWalletHandle(const FInAppWalletHandle& InAppWalletHandle)
 {
 	Type = InAppWalletHandle.GetType();
 	ID = InAppWalletHandle.GetID();
+	Metadata = InAppWalletHandle.Metadata;
 }
 
 FWalletHandle::FWalletHandle(const FSmartWalletHandle& SmartWalletHandle)
 {
 	Type = SmartWalletHandle.GetType();
 	ID = SmartWalletHandle.GetID();
+	Metadata = SmartWalletHandle.Metadata;
 }
 
-FString FWalletHandle::ToAddress() const
+bool FWalletHandle::IsValid() const
 {
-	if (!CachedAddress.IsEmpty())
+	return Type != InvalidHandle && ID != 0 && !(Metadata && Metadata->IsReleased());
+}
+
+void FWalletHandle::Release() const
+{
+	if (Metadata)
 	{
-		return CachedAddress;
+		Metadata->Release();
 	}
+}
+
+FString FWalletHandle::ToAddress() const
+{
 	FString Result;
-	return Thirdweb::get_wallet_address(ID).AssignResult(Result) ? Result : ThirdwebUtils::ZeroAddress;
+	if (Metadata && Metadata->GetAddress(Result))
+	{
+		return Result;
+	}
+	const uint32 Generation = Metadata ? Metadata->GetGeneration() : 0;
+	if (!Thirdweb::get_wallet_address(ID).AssignResult(Result))
+	{
+		return ThirdwebUtils::ZeroAddress;
+	}
+	if (Metadata)
+	{
+		Metadata->SetAddress(Result, Generation);
+	}
+	return Result;
 }
 
-void FWalletHandle::CacheAddress()
+void FWalletHandle::CacheAddress() const
 {
-	if (!CachedAddress.IsEmpty())
+	ToAddress();
+}
+
+void FWalletHandle::BindMetadata()
+{
+	if (ID != 0)
 	{
-		if (FString Result; Thirdweb::get_wallet_address(ID).AssignResult(Result))
-		{
-			CachedAddress = Result;
-		}
+		Metadata = FThirdwebWalletMetadataCache::Get().FindOrAdd(ID, Type);
 	}
 }
 
@@ -51,9 +79,10 @@ void FWalletHandle::Sign(const FString& Message, const FStringDelegate& SuccessD
 	CHECK_VALIDITY(ErrorDelegate)
 
 	FWalletHandle ThisCopy = *this;
-	UE::Tasks::Launch(UE_SOURCE_LOCATION, [ThisCopy, Message, SuccessDelegate, ErrorDelegate]
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Normal, [ThisCopy, Message, SuccessDelegate, ErrorDelegate]
 	{
-		if (FString Error; Thirdweb::sign_message(ThisCopy.GetID(), TO_RUST_STRING(Message)).AssignResult(Error))
+		FThirdwebUtf8Arena Arena;
+		if (FString Error; Thirdweb::sign_message(ThisCopy.GetID(), Arena.Add(Message)).AssignResult(Error))
 		{
 			SuccessDelegate.Execute(Error);
 		} else
@@ -0,0 +1,218 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#include "Wallets/ThirdwebWalletSessionSubsystem.h"
+
+#include "ThirdwebLog.h"
+#include "ThirdwebRuntimeSettings.h"
+#include "Engine/GameInstance.h"
+#include "Internal/ThirdwebFFIExecutor.h"
+#include "Internal/ThirdwebWalletMetadataCache.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeLock.h"
+
+void UThirdwebWalletSessionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UThirdwebWalletSessionSubsystem::Tick), 10.0f);
+}
+
+void UThirdwebWalletSessionSubsystem::Deinitialize()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	for (FShard& Shard : Shards)
+	{
+		// Wallets are released as the sessions go, so do that outside of the lock
+		TMap<FString, FSession> Dropped;
+		{
+			FScopeLock ScopeLock(&Shard.Lock);
+			Dropped = MoveTemp(Shard.Sessions);
+		}
+	}
+	Count = 0;
+	Super::Deinitialize();
+}
+
+void UThirdwebWalletSessionSubsystem::SetSession(const FString& SessionId, const FInAppWalletHandle& InAppWallet, const FSmartWalletHandle& SmartWallet)
+{
+	if (SessionId.IsEmpty())
+	{
+		return;
+	}
+	const int32 MaxSessions = UThirdwebRuntimeSettings::GetMaxWalletSessions();
+	FShard& Shard = GetShard(SessionId);
+	// Sessions leaving the table are destroyed after the lock is released, since that may free their wallets
+	FSession Replaced;
+	TOptional<FSession> Evicted;
+	{
+		FScopeLock ScopeLock(&Shard.Lock);
+		if (FSession* Existing = Shard.Sessions.Find(SessionId))
+		{
+			Replaced = MoveTemp(*Existing);
+			*Existing = {InAppWallet, SmartWallet, FPlatformTime::Seconds()};
+			return;
+		}
+		if (MaxSessions > 0 && Count.load() >= MaxSessions && Shard.Sessions.Num() > 0)
+		{
+			// Exact LRU would need a global order; the oldest session of this shard is close enough and stays cheap
+			const FString* OldestKey = nullptr;
+			double OldestAt = TNumericLimits<double>::Max();
+			for (const TPair<FString, FSession>& Session : Shard.Sessions)
+			{
+				if (Session.Value.LastUsedAt < OldestAt)
+				{
+					OldestKey = &Session.Key;
+					OldestAt = Session.Value.LastUsedAt;
+				}
+			}
+			const FString Key = *OldestKey;
+			Shard.Sessions.RemoveAndCopyValue(Key, Evicted.Emplace());
+			--Count;
+			++EvictedOverBudget;
+		}
+		Shard.Sessions.Add(SessionId, {InAppWallet, SmartWallet, FPlatformTime::Seconds()});
+		++Count;
+	}
+}
+
+bool UThirdwebWalletSessionSubsystem::FindSession(const FString& SessionId, FInAppWalletHandle& InAppWallet, FSmartWalletHandle& SmartWallet)
+{
+	FShard& Shard = GetShard(SessionId);
+	FScopeLock ScopeLock(&Shard.Lock);
+	if (FSession* Session = Shard.Sessions.Find(SessionId))
+	{
+		Session->LastUsedAt = FPlatformTime::Seconds();
+		InAppWallet = Session->InAppWallet;
+		SmartWallet = Session->SmartWallet;
+		return true;
+	}
+	return false;
+}
+
+bool UThirdwebWalletSessionSubsystem::RemoveSession(const FString& SessionId, const bool bDisconnect)
+{
+	FShard& Shard = GetShard(SessionId);
+	FSession Removed;
+	{
+		FScopeLock ScopeLock(&Shard.Lock);
+		if (!Shard.Sessions.RemoveAndCopyValue(SessionId, Removed))
+		{
+			return false;
+		}
+		--Count;
+	}
+	if (bDisconnect && Removed.InAppWallet.IsValid())
+	{
+		Removed.InAppWallet.Disconnect();
+	}
+	return true;
+}
+
+void UThirdwebWalletSessionSubsystem::DisconnectAll()
+{
+	TArray<FInAppWalletHandle> Wallets;
+	Wallets.Reserve(Count.load());
+	for (FShard& Shard : Shards)
+	{
+		TMap<FString, FSession> Dropped;
+		{
+			FScopeLock ScopeLock(&Shard.Lock);
+			Dropped = MoveTemp(Shard.Sessions);
+			Count -= Dropped.Num();
+		}
+		for (TPair<FString, FSession>& Session : Dropped)
+		{
+			if (Session.Value.InAppWallet.IsValid())
+			{
+				Wallets.Add(MoveTemp(Session.Value.InAppWallet));
+			}
+		}
+	}
+	TW_LOG(Verbose, TEXT("UThirdwebWalletSessionSubsystem::DisconnectAll::Wallets=%d"), Wallets.Num())
+	FThirdwebFFIExecutor::Launch(EThirdwebFFIPriority::Background, [Wallets = MoveTemp(Wallets)]
+	{
+		for (const FInAppWalletHandle& Wallet : Wallets)
+		{
+			Wallet.Disconnect();
+		}
+	});
+}
+
+int32 UThirdwebWalletSessionSubsystem::EvictIdle()
+{
+	const float IdleTimeout = UThirdwebRuntimeSettings::GetWalletSessionIdleTimeout();
+	if (IdleTimeout <= 0.0f)
+	{
+		return 0;
+	}
+	const double Cutoff = FPlatformTime::Seconds() - IdleTimeout;
+	int32 Evicted = 0;
+	for (FShard& Shard : Shards)
+	{
+		TArray<FSession> Dropped;
+		{
+			FScopeLock ScopeLock(&Shard.Lock);
+			for (auto It = Shard.Sessions.CreateIterator(); It; ++It)
+			{
+				if (It.Value().LastUsedAt < Cutoff)
+				{
+					Dropped.Add(MoveTemp(It.Value()));
+					It.RemoveCurrent();
+				}
+			}
+			Count -= Dropped.Num();
+		}
+		Evicted += Dropped.Num();
+	}
+	if (Evicted > 0)
+	{
+		EvictedIdle += Evicted;
+		TW_LOG(Verbose, TEXT("UThirdwebWalletSessionSubsystem::EvictIdle::Evicted=%d::Sessions=%d"), Evicted, Count.load())
+	}
+	return Evicted;
+}
+
+FThirdwebWalletSessionStats UThirdwebWalletSessionSubsystem::GetStats() const
+{
+	FThirdwebWalletSessionStats Stats;
+	for (const FShard& Shard : Shards)
+	{
+		FScopeLock ScopeLock(&Shard.Lock);
+		Stats.Sessions += Shard.Sessions.Num();
+		Stats.EstimatedBytes += Shard.Sessions.GetAllocatedSize();
+		for (const TPair<FString, FSession>& Session : Shard.Sessions)
+		{
+			Stats.EstimatedBytes += Session.Key.GetAllocatedSize();
+		}
+	}
+	Stats.EvictedIdle = EvictedIdle.load();
+	Stats.EvictedOverBudget = EvictedOverBudget.load();
+	Stats.LiveWallets = FThirdwebWalletMetadataCache::Get().GetLiveCount();
+	return Stats;
+}
+
+void UThirdwebWalletSessionSubsystem::ForEachSession(TFunctionRef<void(const FString& SessionId, const FInAppWalletHandle& InAppWallet, const FSmartWalletHandle& SmartWallet)> Function) const
+{
+	for (const FShard& Shard : Shards)
+	{
+		FScopeLock ScopeLock(&Shard.Lock);
+		for (const TPair<FString, FSession>& Session : Shard.Sessions)
+		{
+			Function(Session.Key, Session.Value.InAppWallet, Session.Value.SmartWallet);
+		}
+	}
+}
+
+UThirdwebWalletSessionSubsystem* UThirdwebWalletSessionSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(WorldContextObject))
+	{
+		return GameInstance->GetSubsystem<UThirdwebWalletSessionSubsystem>();
+	}
+	return nullptr;
+}
+
+bool UThirdwebWalletSessionSubsystem::Tick(float DeltaTime)
+{
+	EvictIdle();
+	return true;
+}
@@ -0,0 +1,37 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "AsyncTasks/AsyncTaskThirdwebBase.h"
+#include "Engine/Contract/ThirdwebEngineContractCall.h"
+#include "AsyncTaskContractReadBatch.generated.h"
+
+/**
+ * Reads many contract functions in one round trip per chain. Results are in the order of the calls
+ */
+UCLASS(Blueprintable, BlueprintType)
+class THIRDWEB_API UAsyncTaskContractReadBatch : public UAsyncTaskThirdwebBase
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly="true", WorldContext="WorldContextObject"), Category="Thirdweb|Engine|Contract")
+	static UAsyncTaskContractReadBatch* ReadContractBatch(UObject* WorldContextObject, const TArray<FThirdwebEngineContractCall>& Calls);
+
+	virtual void Activate() override;
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FReadBatchDelegate, const TArray<FThirdwebEngineContractCallResult>&, Results, const FString&, Error);
+	UPROPERTY(BlueprintAssignable)
+	FReadBatchDelegate Success;
+
+	UPROPERTY(BlueprintAssignable)
+	FReadBatchDelegate Failed;
+
+protected:
+	UPROPERTY(Transient)
+	TArray<FThirdwebEngineContractCall> Calls;
+
+private:
+	virtual void HandleResponse(const TArray<FThirdwebEngineContractCallResult>& Results);
+	void HandleFailed(const FString& Error);
+};
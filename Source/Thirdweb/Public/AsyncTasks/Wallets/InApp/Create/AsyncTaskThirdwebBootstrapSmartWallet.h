@@ -0,0 +1,68 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "AsyncTasks/AsyncTaskThirdwebBase.h"
+#include "Containers/ThirdwebWalletBootstrapResult.h"
+#include "Wallets/ThirdwebInAppWalletHandle.h"
+#include "AsyncTaskThirdwebBootstrapSmartWallet.generated.h"
+
+UCLASS(Abstract)
+class THIRDWEB_API UAsyncTaskThirdwebBootstrapSmartWallet : public UAsyncTaskThirdwebBase
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Activate() override;
+
+	/** Creates a smart wallet for a signed in in-app wallet and fetches its addresses, deploy status and active signers in one go */
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly="true", WorldContext="WorldContextObject", AdvancedDisplay="Factory,AccountOverride"), Category="Thirdweb|Wallets|Smart")
+	static UAsyncTaskThirdwebBootstrapSmartWallet* BootstrapSmartWallet(
+		UObject* WorldContextObject,
+		const FInAppWalletHandle& InAppWallet,
+		const int64 ChainID,
+		const bool bGasless = true,
+		const FString& Factory = "",
+		const FString& AccountOverride = ""
+	)
+	{
+		NEW_TASK
+		Task->InAppWallet = InAppWallet;
+		Task->ChainID = ChainID;
+		Task->bGasless = bGasless;
+		Task->Factory = Factory;
+		Task->AccountOverride = AccountOverride;
+		RR_TASK
+	};
+
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FBootstrapSmartWalletDelegate, const FThirdwebWalletBootstrapResult&, Result, const FString&, Error);
+
+	UPROPERTY(BlueprintAssignable)
+	FBootstrapSmartWalletDelegate Success;
+
+	UPROPERTY(BlueprintAssignable)
+	FBootstrapSmartWalletDelegate Failed;
+
+protected:
+	UPROPERTY(Transient)
+	FInAppWalletHandle InAppWallet;
+
+	UPROPERTY(Transient)
+	int64 ChainID;
+
+	UPROPERTY(Transient)
+	bool bGasless;
+
+	UPROPERTY(Transient)
+	FString Factory;
+
+	UPROPERTY(Transient)
+	FString AccountOverride;
+
+private:
+	UFUNCTION()
+	void HandleResponse(const FThirdwebWalletBootstrapResult& Result);
+
+	UFUNCTION()
+	virtual void HandleFailed(const FString& Error);
+};
@@ -0,0 +1,19 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "AsyncTaskThirdwebInAppCreateWalletBase.h"
+#include "AsyncTaskThirdwebWarmStartWallet.generated.h"
+
+UCLASS(Abstract)
+class THIRDWEB_API UAsyncTaskThirdwebWarmStartWallet : public UAsyncTaskThirdwebInAppCreateWalletBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Restores the wallet of the last session without waiting on the network. Is Connected turns false if the session turns out to have expired */
+	UFUNCTION(BlueprintCallable, meta=(BlueprintInternalUseOnly="true", WorldContext="WorldContextObject"), Category="Thirdweb|Wallets|InApp")
+	static UAsyncTaskThirdwebWarmStartWallet* WarmStartWallet(UObject* WorldContextObject) { CREATE_WALLET_TASK }
+
+	virtual void Activate() override;
+};
@@ -32,10 +32,7 @@ protected:
 	
 private:
 	UFUNCTION()
-	void HandleIsDeployedResponse(const bool bDeployed);
-	
-	UFUNCTION()
-	void HandleResponse(const TArray<FSigner>& Signers);
+	void HandleResponse(const bool bActiveSigner);
 	
 	UFUNCTION()
 	virtual void HandleFailed(const FString& Error);
@@ -5,6 +5,8 @@
 #include "Misc/DateTime.h"
 #include "ThirdwebSigner.generated.h"
 
+class FThirdwebJsonReader;
+
 USTRUCT(BlueprintType)
 struct THIRDWEB_API FSigner
 {
@@ -26,6 +28,7 @@ struct THIRDWEB_API FSigner
 	FDateTime EndTime;
 
 	static FSigner FromJson(const TSharedPtr<class FJsonObject>& JsonObject);
+	static FSigner FromJson(FThirdwebJsonReader& Reader);
 
 	bool operator==(const FSigner& Other) const
 	{
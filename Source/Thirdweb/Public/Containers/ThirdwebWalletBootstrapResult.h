@@ -0,0 +1,59 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ThirdwebSigner.h"
+#include "Wallets/ThirdwebSmartWalletHandle.h"
+#include "ThirdwebWalletBootstrapResult.generated.h"
+
+/** Milliseconds spent in every stage of a wallet bootstrap. Stages after the smart wallet creation run side by side */
+USTRUCT(BlueprintType, DisplayName="Wallet Bootstrap Timings")
+struct THIRDWEB_API FThirdwebWalletBootstrapTimings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, meta=(Units="ms"), Category="Thirdweb|Wallets|Bootstrap")
+	float CreateSmartWallet = 0.0f;
+
+	/** Runs alongside the smart wallet creation */
+	UPROPERTY(BlueprintReadOnly, meta=(Units="ms"), Category="Thirdweb|Wallets|Bootstrap")
+	float InAppAddress = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, meta=(Units="ms"), Category="Thirdweb|Wallets|Bootstrap")
+	float SmartWalletAddress = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, meta=(Units="ms"), Category="Thirdweb|Wallets|Bootstrap")
+	float DeployCheck = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, meta=(Units="ms"), Category="Thirdweb|Wallets|Bootstrap")
+	float ActiveSigners = 0.0f;
+
+	/** From the call until the result, i.e. the critical path rather than the sum of the stages */
+	UPROPERTY(BlueprintReadOnly, meta=(Units="ms"), Category="Thirdweb|Wallets|Bootstrap")
+	float Total = 0.0f;
+};
+
+USTRUCT(BlueprintType, DisplayName="Wallet Bootstrap Result")
+struct THIRDWEB_API FThirdwebWalletBootstrapResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Bootstrap")
+	FSmartWalletHandle SmartWallet;
+
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Bootstrap")
+	FString InAppAddress;
+
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Bootstrap")
+	FString SmartWalletAddress;
+
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Bootstrap")
+	bool bDeployed = false;
+
+	/** Empty if the account is not deployed yet or the signers could not be fetched */
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Bootstrap")
+	TArray<FSigner> ActiveSigners;
+
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Bootstrap")
+	FThirdwebWalletBootstrapTimings Timings;
+};
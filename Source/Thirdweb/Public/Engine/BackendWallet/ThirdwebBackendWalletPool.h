@@ -0,0 +1,133 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "ThirdwebMacros.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Templates/Function.h"
+#include "ThirdwebBackendWalletPool.generated.h"
+
+struct FSmartWalletHandle;
+struct FThirdwebEngineTransactionOverrides;
+struct FThirdwebEngineTransactionStatusResult;
+
+UENUM(BlueprintType, DisplayName="Backend Wallet Pool Strategy")
+enum class EThirdwebBackendWalletPoolStrategy : uint8
+{
+	/** Every wallet in turn */
+	RoundRobin UMETA(DisplayName="Round Robin"),
+	/** The wallet with the fewest transactions still in flight, in turn among equals */
+	LeastPending UMETA(DisplayName="Least Pending")
+};
+
+/**
+ * Spreads Engine writes over several backend wallets, so that they are not all serialized behind the nonce sequence of
+ * a single wallet.
+ *
+ * The pool is seeded from UThirdwebRuntimeSettings::GetEngineSigners() and can be reseeded from Engine's backend wallets
+ * or an explicit list. Writes sharing a pin key go through the same wallet while any of its writes is in flight, which
+ * keeps their relative order. Pins expire once their wallet has nothing in flight, as nothing is left to order against
+ * then, so a long running server does not keep one pin per key it ever saw.
+ *
+ * A write counts towards the queue depth of its wallet from dispatch until the transaction tracker reports its
+ * transaction mined, errored or cancelled, gives up on it, or stops tracking it.
+ */
+UCLASS()
+class THIRDWEB_API UThirdwebBackendWalletPool : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Sends a write from BackendWalletAddress, e.g. through one of the ThirdwebEngine write functions */
+	using FSendFunction = TFunction<void(const FString& BackendWalletAddress, const FStringDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)>;
+
+	/** Overrides */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Thirdweb|Engine|Backend Wallet")
+	EThirdwebBackendWalletPoolStrategy Strategy = EThirdwebBackendWalletPoolStrategy::LeastPending;
+
+	/** Replaces the wallets of the pool. Queue depths of wallets that stay in the pool are kept, pins to removed wallets are dropped */
+	UFUNCTION(BlueprintCallable, Category="Thirdweb|Engine|Backend Wallet")
+	void SetWallets(const TArray<FString>& Addresses);
+
+	/** Reseeds the pool with every backend wallet of the Engine instance */
+	void SeedFromEngine(const FSimpleDelegate& CompleteDelegate, const FStringDelegate& ErrorDelegate);
+
+	UFUNCTION(BlueprintPure, Category="Thirdweb|Engine|Backend Wallet")
+	TArray<FString> GetWallets() const;
+
+	/**
+	 * Picks the wallet of the next write.
+	 *
+	 * @param PinKey Writes with the same non-empty key get the same wallet, as long as it has writes in flight.
+	 * @return The wallet address, empty if the pool is empty.
+	 */
+	UFUNCTION(BlueprintCallable, meta=(AutoCreateRefTerm="PinKey"), Category="Thirdweb|Engine|Backend Wallet")
+	FString Acquire(const FString& PinKey);
+
+	/** Lets the next write with the key go to any wallet */
+	UFUNCTION(BlueprintCallable, Category="Thirdweb|Engine|Backend Wallet")
+	void Unpin(const FString& PinKey);
+
+	/**
+	 * Sends a write from a pooled wallet and counts it against that wallet until its transaction completes.
+	 *
+	 * @param PinKey Writes with the same non-empty key go through the same wallet.
+	 * @param Send Sends the write from the wallet it is given.
+	 * @param SuccessDelegate Executed with the queue ID.
+	 */
+	void Dispatch(const FString& PinKey, FSendFunction&& Send, const FStringDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
+
+	/** Pooled counterpart of ThirdwebEngine::Contract::Write */
+	void Write(
+		const FString& PinKey,
+		const int64 ChainId,
+		const FString& ContractAddress,
+		const FSmartWalletHandle& SmartWallet,
+		const FString& FactoryAddress,
+		const FString& IdempotencyKey,
+		const FString& FunctionName,
+		const TArray<FString>& Args,
+		const FThirdwebEngineTransactionOverrides& TxOverrides,
+		const FString& Abi,
+		const FStringDelegate& SuccessDelegate,
+		const FStringDelegate& ErrorDelegate
+	);
+
+	/** Transactions of the wallet still in flight */
+	UFUNCTION(BlueprintPure, Category="Thirdweb|Engine|Backend Wallet")
+	int32 GetQueueDepth(const FString& BackendWalletAddress) const;
+
+	/** Transactions in flight per wallet of the pool */
+	UFUNCTION(BlueprintPure, Category="Thirdweb|Engine|Backend Wallet")
+	TMap<FString, int32> GetQueueDepths() const;
+
+	UFUNCTION(BlueprintPure, meta=(WorldContext="WorldContextObject"), Category="Thirdweb|Engine|Backend Wallet")
+	static UThirdwebBackendWalletPool* Get(const UObject* WorldContextObject);
+
+private:
+	struct FWallet
+	{
+		FString Address;
+		int32 Pending = 0;
+	};
+
+	int32 FindWallet(const FString& Address) const;
+	void Release(const FString& Address);
+
+	/** Drops the pins of wallets without transactions in flight */
+	void ExpireIdlePins();
+	void OnStatus(const FThirdwebEngineTransactionStatusResult& Result, FString Address);
+
+	TArray<FWallet> Wallets;
+
+	/** Lowercased address of the wallet every pin key is bound to */
+	TMap<FString, FString> Pins;
+
+	/** Pins from Acquire alone never see their wallet go idle, so idle pins are also swept once this many are held */
+	static constexpr int32 MaxIdlePins = 1024;
+
+	/** Where the next pick starts, so that equal candidates take turns */
+	int32 Cursor = 0;
+};
@@ -3,8 +3,10 @@
 #pragma once
 
 #include "ThirdwebMacros.h"
+#include "Engine/ThirdwebEnginePager.h"
 
 struct FThirdwebBackendWallet;
+struct FThirdwebEngineRawTransaction;
 struct FThirdwebURLSearchParams;
 
 namespace ThirdwebEngine::BackendWallet
@@ -19,4 +21,34 @@ namespace ThirdwebEngine::BackendWallet
 		const FGetAllDelegate& SuccessDelegate,
 		const FStringDelegate& ErrorDelegate
 	);
+
+	/**
+	 * Fetches every backend wallet, Options.PageSize wallets per request with up to Options.MaxConcurrentPages requests
+	 * in flight. Engine does not report a total, so pages are requested ahead and the first short page ends the walk.
+	 *
+	 * @return The running pager. Fire and forget, or keep it to cancel early.
+	 */
+	extern TSharedRef<TThirdwebEnginePager<FThirdwebBackendWallet>> GetAllPaged(
+		const UObject* Outer,
+		const FThirdwebEnginePagerOptions& Options,
+		const FGetAllDelegate& PageDelegate,
+		const FThirdwebEnginePagerProgressDelegate& ProgressDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	);
+
+	/**
+	 * Queues several pre-encoded transactions from one backend wallet in a single request.
+	 *
+	 * @param SuccessDelegate Executed with one queue ID per transaction, in order.
+	 */
+	extern THIRDWEB_API void SendTransactionBatch(
+		const UObject* Outer,
+		const int64 ChainId,
+		const FString& BackendWalletAddress,
+		const TArray<FThirdwebEngineRawTransaction>& Transactions,
+		const FString& IdempotencyKey,
+		const FStringArrayDelegate& SuccessDelegate,
+		const FStringDelegate& ErrorDelegate
+	);
 }
@@ -0,0 +1,47 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "ThirdwebEngineContractCall.generated.h"
+
+class FJsonObject;
+
+USTRUCT(BlueprintType, DisplayName="Contract Call")
+struct THIRDWEB_API FThirdwebEngineContractCall
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Thirdweb|Engine")
+	int64 ChainId = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Thirdweb|Engine")
+	FString ContractAddress;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Thirdweb|Engine")
+	FString FunctionName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Thirdweb|Engine")
+	TArray<FString> Args;
+
+	/** Entry of a read-batch request. The chain is part of the request URL */
+	TSharedPtr<FJsonObject> ToJson() const;
+};
+
+USTRUCT(BlueprintType, DisplayName="Contract Call Result")
+struct THIRDWEB_API FThirdwebEngineContractCallResult
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Engine")
+	bool bSuccess = false;
+
+	/** The returned value as a JSON string, as returned by a single read */
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Engine")
+	FString Result;
+
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Engine")
+	FString Error;
+
+	static FThirdwebEngineContractCallResult FromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	static FThirdwebEngineContractCallResult MakeError(const FString& Error);
+};
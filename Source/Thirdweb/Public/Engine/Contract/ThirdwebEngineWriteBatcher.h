@@ -0,0 +1,72 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "ThirdwebMacros.h"
+#include "Containers/Ticker.h"
+#include "Engine/Transaction/ThirdwebEngineRawTransaction.h"
+#include "HAL/CriticalSection.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+/**
+ * Collects pre-encoded transactions sent from the same backend wallet on the same chain for
+ * UThirdwebRuntimeSettings::GetEngineWriteBatchWindow() and submits them as one `send-transaction-batch` request.
+ * Every caller still receives the queue ID of its own transaction. A batch is submitted early once it holds
+ * UThirdwebRuntimeSettings::GetEngineWriteBatchMaxSize() transactions.
+ *
+ * Function name writes are not batched: Engine has no batch endpoint for them, so windowing them would only delay them.
+ */
+class THIRDWEB_API FThirdwebEngineWriteBatcher
+{
+public:
+	/** Process-wide batcher instance */
+	static FThirdwebEngineWriteBatcher& Get();
+
+	/**
+	 * Queues a pre-encoded transaction from a backend wallet.
+	 *
+	 * @param SuccessDelegate Executed with the queue ID of this transaction.
+	 */
+	void SendTransaction(
+		const UObject* Outer,
+		const int64 ChainId,
+		const FString& BackendWalletAddress,
+		const FThirdwebEngineRawTransaction& Transaction,
+		const FStringDelegate& SuccessDelegate,
+		const FStringDelegate& ErrorDelegate
+	);
+
+	/** Submits every pending batch now */
+	void Flush();
+
+	/** Number of transactions waiting for their window to close */
+	int32 GetPendingCount() const;
+
+private:
+	struct FPendingTransaction
+	{
+		TWeakObjectPtr<const UObject> Outer;
+		FThirdwebEngineRawTransaction Transaction;
+		FStringDelegate SuccessDelegate;
+		FStringDelegate ErrorDelegate;
+	};
+
+	struct FBatch
+	{
+		int64 ChainId = 0;
+		FString BackendWalletAddress;
+		TArray<FPendingTransaction> Transactions;
+		/** Closes the window, removed if the batch is submitted before that */
+		FTSTicker::FDelegateHandle TickerHandle;
+	};
+
+	FThirdwebEngineWriteBatcher() = default;
+
+	static FString MakeKey(const int64 ChainId, const FString& BackendWalletAddress);
+
+	void FlushBatch(const FString& Key);
+	static void Submit(FBatch&& Batch);
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FBatch> Batches;
+};
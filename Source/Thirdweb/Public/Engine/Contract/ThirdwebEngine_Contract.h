@@ -4,6 +4,8 @@
 
 #include "ThirdwebMacros.h"
 
+struct FThirdwebEngineContractCall;
+struct FThirdwebEngineContractCallResult;
 struct FThirdwebEngineTransactionOverrides;
 struct FSmartWalletHandle;
 struct FThirdwebURLSearchParams;
@@ -21,6 +23,24 @@ namespace ThirdwebEngine::Contract
 		const FStringDelegate& SuccessDelegate,
 		const FStringDelegate& ErrorDelegate
 	);
+
+	DECLARE_DELEGATE_OneParam(FReadBatchDelegate, const TArray<FThirdwebEngineContractCallResult>& /* Results */)
+
+	/**
+	 * Reads many contract functions at once. Calls are grouped per chain and each group is aggregated by Engine into
+	 * multicall reads, so a chain costs one round trip per 100 calls instead of one per call.
+	 *
+	 * @param Calls The calls to make, on any number of chains.
+	 * @param SuccessDelegate Executed once every group has completed, with one result per call in input order. A call
+	 *                        that reverted, or whose group failed, has bSuccess unset and the reason in Error.
+	 * @param ErrorDelegate Executed if Calls is empty.
+	 */
+	extern THIRDWEB_API void ReadBatch(
+		const UObject* Outer,
+		const TArray<FThirdwebEngineContractCall>& Calls,
+		const FReadBatchDelegate& SuccessDelegate,
+		const FStringDelegate& ErrorDelegate
+	);
 	
 	extern THIRDWEB_API void Write(
 		const UObject* Outer,
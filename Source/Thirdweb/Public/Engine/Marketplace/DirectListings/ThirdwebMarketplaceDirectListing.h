@@ -8,12 +8,16 @@
 
 class FJsonObject;
 class FJsonValue;
+class FThirdwebJsonReader;
 
 USTRUCT(BlueprintType, DisplayName="Marketplace Listing")
 struct THIRDWEB_API FThirdwebMarketplaceDirectListing : public FThirdwebMarketplaceInternalEntryBase
 {
 	GENERATED_BODY()
 	
+	UPROPERTY(BlueprintReadWrite, Category="Listing")
+	FString CreatorAddress;
+
 	UPROPERTY(BlueprintReadWrite, Category="Listing")
 	FString PricePerToken;
 
@@ -25,6 +29,7 @@ struct THIRDWEB_API FThirdwebMarketplaceDirectListing : public FThirdwebMarketpl
 
 	static FThirdwebMarketplaceDirectListing FromJson(const TSharedPtr<FJsonObject>& JsonObject);
 	static TArray<FThirdwebMarketplaceDirectListing> FromJson(const TArray<TSharedPtr<FJsonValue>>& JsonArray);
+	static FThirdwebMarketplaceDirectListing FromJson(FThirdwebJsonReader& Reader);
 
 	friend uint32 GetTypeHash(const FThirdwebMarketplaceDirectListing& Other)
 	{
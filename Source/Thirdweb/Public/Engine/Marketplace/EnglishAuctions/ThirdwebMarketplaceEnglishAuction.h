@@ -7,11 +7,16 @@
 #include "Misc/DateTime.h"
 #include "ThirdwebMarketplaceEnglishAuction.generated.h"
 
+class FThirdwebJsonReader;
+
 USTRUCT(BlueprintType, DisplayName="Marketplace English Auction")
 struct THIRDWEB_API FThirdwebMarketplaceEnglishAuction : public FThirdwebMarketplaceInternalEntryBase
 {
 	GENERATED_BODY()
 	
+	UPROPERTY(BlueprintReadWrite, Category="Auction")
+	FString CreatorAddress;
+
 	UPROPERTY(BlueprintReadWrite, Category="Auction")
 	FString MinimumBidAmount;
 
@@ -29,6 +34,7 @@ struct THIRDWEB_API FThirdwebMarketplaceEnglishAuction : public FThirdwebMarketp
 	
 	static FThirdwebMarketplaceEnglishAuction FromJson(const TSharedPtr<FJsonObject>& JsonObject);
 	static TArray<FThirdwebMarketplaceEnglishAuction> FromJson(const TArray<TSharedPtr<FJsonValue>>& JsonArray);
+	static FThirdwebMarketplaceEnglishAuction FromJson(FThirdwebJsonReader& Reader);
 
 	friend uint32 GetTypeHash(const FThirdwebMarketplaceEnglishAuction& Other)
 	{
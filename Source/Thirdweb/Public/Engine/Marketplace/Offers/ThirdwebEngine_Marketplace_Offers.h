@@ -4,6 +4,7 @@
 
 #include "ThirdwebMacros.h"
 #include "ThirdwebMarketplaceOffer.h"
+#include "Engine/ThirdwebEnginePager.h"
 
 struct FThirdwebMarketplaceMakeOfferRequest;
 struct FThirdwebAccountIdentifierParams;
@@ -28,6 +29,50 @@ namespace ThirdwebEngine::Marketplace::Offers
 		const FStringDelegate& ErrorDelegate
 	);
 
+	/**
+	 * Streaming variant of GetAll for large pages. Offers are decoded one by one off the game thread and passed to
+	 * BatchDelegate in batches of up to BatchSize as soon as they are ready, instead of in a single array at the end.
+	 * CompleteDelegate fires after the last batch. ErrorDelegate may fire after some batches if the payload is malformed.
+	 */
+	extern THIRDWEB_API void GetAllStreamed(
+		const UObject* Outer,
+		const int32 Count,
+		const FString& Offeror,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const int32 BatchSize,
+		const FGetAllDelegate& BatchDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	);
+
+	/**
+	 * Fetches every offer from Start on, Options.PageSize offers per request with up to Options.MaxConcurrentPages
+	 * requests in flight. The number of pages is derived from GetTotalCount. Pages are passed to PageDelegate in order
+	 * unless Options.bInOrder is cleared, and ProgressDelegate fires after each page.
+	 *
+	 * @return The running pager. Fire and forget, or keep it to cancel early.
+	 */
+	extern THIRDWEB_API TSharedRef<TThirdwebEnginePager<FThirdwebMarketplaceOffer>> GetAllPaged(
+		const UObject* Outer,
+		const FString& Offeror,
+		const int32 Start,
+		const FString& TokenContract,
+		const FString& TokenId,
+		const int64 Chain,
+		const FString& ContractAddress,
+		const bool bOnlyValid,
+		const FThirdwebEnginePagerOptions& Options,
+		const FGetAllDelegate& PageDelegate,
+		const FThirdwebEnginePagerProgressDelegate& ProgressDelegate,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	);
+
 	DECLARE_DELEGATE_OneParam(FGetOfferDelegate, const FThirdwebMarketplaceOffer& /* Offer */)
 	extern THIRDWEB_API void Get(
 		const UObject* Outer,
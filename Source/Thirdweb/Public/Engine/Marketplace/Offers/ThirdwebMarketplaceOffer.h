@@ -7,6 +7,7 @@
 
 class FJsonObject;
 class FJsonValue;
+class FThirdwebJsonReader;
 
 USTRUCT(BlueprintType, DisplayName="Marketplace Offer")
 struct THIRDWEB_API FThirdwebMarketplaceOffer : public FThirdwebMarketplaceInternalEntryBase
@@ -24,6 +25,7 @@ struct THIRDWEB_API FThirdwebMarketplaceOffer : public FThirdwebMarketplaceInter
 	
 	static FThirdwebMarketplaceOffer FromJson(const TSharedPtr<FJsonObject>& JsonObject);
 	static TArray<FThirdwebMarketplaceOffer> FromJson(const TArray<TSharedPtr<FJsonValue>>& JsonArray);
+	static FThirdwebMarketplaceOffer FromJson(FThirdwebJsonReader& Reader);
 
 	friend uint32 GetTypeHash(const FThirdwebMarketplaceOffer& Other)
 	{
@@ -0,0 +1,326 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "ThirdwebMacros.h"
+#include "Engine/Marketplace/DirectListings/ThirdwebMarketplaceDirectListing.h"
+#include "Engine/Marketplace/EnglishAuctions/ThirdwebMarketplaceEnglishAuction.h"
+#include "Engine/Marketplace/Offers/ThirdwebMarketplaceOffer.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "ThirdwebMarketplaceIndex.generated.h"
+
+UENUM(BlueprintType)
+enum class EThirdwebMarketplaceSort : uint8
+{
+	None UMETA(DisplayName="None"),
+	PriceAscending UMETA(DisplayName="Price Ascending"),
+	PriceDescending UMETA(DisplayName="Price Descending"),
+	EndTimeAscending UMETA(DisplayName="End Time Ascending"),
+	EndTimeDescending UMETA(DisplayName="End Time Descending")
+};
+
+USTRUCT(BlueprintType, DisplayName="Marketplace Query")
+struct THIRDWEB_API FThirdwebMarketplaceQuery
+{
+	GENERATED_BODY()
+
+	/** Creator of listings and auctions, offeror of offers. Ignored if empty */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Filter")
+	FString Seller;
+
+	/** Ignored if empty */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Filter")
+	FString AssetContractAddress;
+
+	/** Ignored if empty */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Filter")
+	FString TokenId;
+
+	/** Ignored if empty */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Filter")
+	FString CurrencyContractAddress;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Filter")
+	bool bOnlyActive = false;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Sort")
+	EThirdwebMarketplaceSort Sort = EThirdwebMarketplaceSort::None;
+
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, meta=(ClampMin=0, UIMin=0), Category="Page")
+	int32 Offset = 0;
+
+	/** 0 = Everything */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, meta=(ClampMin=0, UIMin=0), Category="Page")
+	int32 Limit = 0;
+};
+
+namespace ThirdwebMarketplaceIndex
+{
+	/** Addresses are compared case-insensitively, as checksummed and lowercase forms are both common */
+	inline FString MakeKey(const FString& Value) { return Value.ToLower(); }
+
+	/** Orders unsigned base 10 amounts, such as wei values, numerically regardless of their length */
+	extern THIRDWEB_API bool IsAmountLess(const FString& A, const FString& B);
+
+	inline const FString& GetSeller(const FThirdwebMarketplaceDirectListing& Listing) { return Listing.CreatorAddress; }
+	inline const FString& GetSeller(const FThirdwebMarketplaceEnglishAuction& Auction) { return Auction.CreatorAddress; }
+	inline const FString& GetSeller(const FThirdwebMarketplaceOffer& Offer) { return Offer.OfferorAddress; }
+
+	inline const FString& GetPrice(const FThirdwebMarketplaceDirectListing& Listing) { return Listing.PricePerToken; }
+	inline const FString& GetPrice(const FThirdwebMarketplaceEnglishAuction& Auction) { return Auction.MinimumBidAmount; }
+	inline const FString& GetPrice(const FThirdwebMarketplaceOffer& Offer) { return Offer.TotalPrice; }
+}
+
+/**
+ * In-memory index over one kind of marketplace entry, keyed by entry ID.
+ *
+ * Hash indices on seller, asset contract, token ID and currency narrow a query down to its candidates, and the price and
+ * end time orders are kept presorted so unfiltered sorted queries are a single walk. Indices are rebuilt lazily on the
+ * first query after entries changed. Not thread safe: use it from the game thread only.
+ */
+template <typename T>
+class TThirdwebMarketplaceEntryIndex
+{
+public:
+	/** Inserts new entries and replaces known ones with the same ID */
+	void Upsert(const TArray<T>& InEntries)
+	{
+		for (const T& Entry : InEntries)
+		{
+			if (const int32* Existing = ById.Find(Entry.Id))
+			{
+				Entries[*Existing] = Entry;
+			}
+			else
+			{
+				ById.Add(Entry.Id, Entries.Add(Entry));
+			}
+		}
+		bDirty |= InEntries.Num() > 0;
+	}
+
+	void Reset()
+	{
+		Entries.Empty();
+		ById.Empty();
+		bDirty = true;
+	}
+
+	int32 Num() const { return Entries.Num(); }
+
+	const T* Find(const FString& Id) const
+	{
+		const int32* Index = ById.Find(Id);
+		return Index ? &Entries[*Index] : nullptr;
+	}
+
+	TArray<T> Query(const FThirdwebMarketplaceQuery& Query) const
+	{
+		using namespace ThirdwebMarketplaceIndex;
+		Rebuild();
+
+		// Start from the most selective hash index
+		const TArray<int32>* Candidates = nullptr;
+		auto Narrow = [&Candidates](const TMap<FString, TArray<int32>>& Index, const FString& Value)
+		{
+			if (!Value.IsEmpty())
+			{
+				const TArray<int32>* Found = Index.Find(MakeKey(Value));
+				static const TArray<int32> None;
+				if (!Found)
+				{
+					Found = &None;
+				}
+				if (!Candidates || Found->Num() < Candidates->Num())
+				{
+					Candidates = Found;
+				}
+			}
+		};
+		Narrow(BySeller, Query.Seller);
+		Narrow(ByAssetContract, Query.AssetContractAddress);
+		Narrow(ByTokenId, Query.TokenId);
+		Narrow(ByCurrency, Query.CurrencyContractAddress);
+
+		auto Matches = [this, &Query](const int32 Index)
+		{
+			const T& Entry = Entries[Index];
+			return (Query.Seller.IsEmpty() || GetSeller(Entry).Equals(Query.Seller, ESearchCase::IgnoreCase))
+				&& (Query.AssetContractAddress.IsEmpty() || Entry.AssetContractAddress.Equals(Query.AssetContractAddress, ESearchCase::IgnoreCase))
+				&& (Query.TokenId.IsEmpty() || Entry.TokenId.Equals(Query.TokenId))
+				&& (Query.CurrencyContractAddress.IsEmpty() || Entry.CurrencyContractAddress.Equals(Query.CurrencyContractAddress, ESearchCase::IgnoreCase))
+				&& (!Query.bOnlyActive || Entry.Status == EThirdwebMarketplaceListingStatus::Active);
+		};
+
+		const bool bDescending = Query.Sort == EThirdwebMarketplaceSort::PriceDescending || Query.Sort == EThirdwebMarketplaceSort::EndTimeDescending;
+		const bool bByPrice = Query.Sort == EThirdwebMarketplaceSort::PriceAscending || Query.Sort == EThirdwebMarketplaceSort::PriceDescending;
+		TArray<int32> Order;
+		if (Candidates)
+		{
+			Order.Reserve(Candidates->Num());
+			for (const int32 Index : *Candidates)
+			{
+				if (Matches(Index))
+				{
+					Order.Add(Index);
+				}
+			}
+			if (Query.Sort != EThirdwebMarketplaceSort::None)
+			{
+				const TArray<int32>& Rank = bByPrice ? PriceRank : EndTimeRank;
+				Order.Sort([&Rank, bDescending](const int32 A, const int32 B) { return bDescending ? Rank[A] > Rank[B] : Rank[A] < Rank[B]; });
+			}
+		}
+		else
+		{
+			// No hash filter: walk the presorted order, or the insertion order when unsorted
+			const TArray<int32>* Sorted = Query.Sort == EThirdwebMarketplaceSort::None ? nullptr : bByPrice ? &ByPrice : &ByEndTime;
+			Order.Reserve(Entries.Num());
+			for (int32 i = 0; i < Entries.Num(); i++)
+			{
+				const int32 Index = Sorted ? (*Sorted)[bDescending ? Entries.Num() - 1 - i : i] : i;
+				if (Matches(Index))
+				{
+					Order.Add(Index);
+				}
+			}
+		}
+
+		TArray<T> Result;
+		const int32 First = FMath::Clamp(Query.Offset, 0, Order.Num());
+		const int32 Last = Query.Limit > 0 ? FMath::Min(Order.Num(), First + Query.Limit) : Order.Num();
+		Result.Reserve(Last - First);
+		for (int32 i = First; i < Last; i++)
+		{
+			Result.Add(Entries[Order[i]]);
+		}
+		return Result;
+	}
+
+private:
+	void Rebuild() const
+	{
+		using namespace ThirdwebMarketplaceIndex;
+		if (!bDirty)
+		{
+			return;
+		}
+		BySeller.Reset();
+		ByAssetContract.Reset();
+		ByTokenId.Reset();
+		ByCurrency.Reset();
+		for (int32 i = 0; i < Entries.Num(); i++)
+		{
+			const T& Entry = Entries[i];
+			BySeller.FindOrAdd(MakeKey(GetSeller(Entry))).Add(i);
+			ByAssetContract.FindOrAdd(MakeKey(Entry.AssetContractAddress)).Add(i);
+			ByTokenId.FindOrAdd(MakeKey(Entry.TokenId)).Add(i);
+			ByCurrency.FindOrAdd(MakeKey(Entry.CurrencyContractAddress)).Add(i);
+		}
+
+		auto BuildOrder = [this](TArray<int32>& Order, TArray<int32>& Rank, TFunctionRef<bool(const T&, const T&)> Less)
+		{
+			Order.SetNumUninitialized(Entries.Num());
+			for (int32 i = 0; i < Order.Num(); i++)
+			{
+				Order[i] = i;
+			}
+			Order.StableSort([this, &Less](const int32 A, const int32 B) { return Less(Entries[A], Entries[B]); });
+			Rank.SetNumUninitialized(Entries.Num());
+			for (int32 i = 0; i < Order.Num(); i++)
+			{
+				Rank[Order[i]] = i;
+			}
+		};
+		BuildOrder(ByPrice, PriceRank, [](const T& A, const T& B) { return IsAmountLess(GetPrice(A), GetPrice(B)); });
+		BuildOrder(ByEndTime, EndTimeRank, [](const T& A, const T& B) { return A.EndTimeInSeconds < B.EndTimeInSeconds; });
+		bDirty = false;
+	}
+
+	TArray<T> Entries;
+	TMap<FString, int32> ById;
+
+	/** Lowercase key -> Entry indices, in insertion order */
+	mutable TMap<FString, TArray<int32>> BySeller;
+	mutable TMap<FString, TArray<int32>> ByAssetContract;
+	mutable TMap<FString, TArray<int32>> ByTokenId;
+	mutable TMap<FString, TArray<int32>> ByCurrency;
+
+	/** Entry indices sorted ascending, and the position of every entry in that order */
+	mutable TArray<int32> ByPrice;
+	mutable TArray<int32> PriceRank;
+	mutable TArray<int32> ByEndTime;
+	mutable TArray<int32> EndTimeRank;
+	mutable bool bDirty = true;
+};
+
+/**
+ * Local copy of the listings, auctions and offers of a marketplace contract, answering filter and sort queries without
+ * a round trip to Engine.
+ *
+ * Marketplace IDs are sequential, so Refresh only fetches the entries created since the previous refresh, using
+ * GetTotalCount to find the new range. Entries already indexed are not refetched: pass bFull to pick up status and price
+ * changes of existing entries.
+ */
+class THIRDWEB_API FThirdwebMarketplaceIndex : public TSharedFromThis<FThirdwebMarketplaceIndex>
+{
+public:
+	FThirdwebMarketplaceIndex(const int64 InChainId, const FString& InContractAddress);
+
+	/**
+	 * Fetches new entries of every section into the index. Calls made while a refresh is running join it, except for a
+	 * full refresh asked for during an incremental one, which would skip the entries it is after: that one is queued,
+	 * and starts as soon as the running refresh ends. Every refresh completes or fails, even if its outer goes away.
+	 *
+	 * @param Outer Owner of the underlying requests.
+	 * @param bFull Refetch every entry instead of only the new ones.
+	 */
+	void Refresh(const UObject* Outer, const bool bFull, const FSimpleDelegate& CompleteDelegate, const FStringDelegate& ErrorDelegate);
+
+	bool IsRefreshing() const { return PendingSections > 0; }
+
+	const TThirdwebMarketplaceEntryIndex<FThirdwebMarketplaceDirectListing>& GetListings() const { return Listings; }
+	const TThirdwebMarketplaceEntryIndex<FThirdwebMarketplaceEnglishAuction>& GetAuctions() const { return Auctions; }
+	const TThirdwebMarketplaceEntryIndex<FThirdwebMarketplaceOffer>& GetOffers() const { return Offers; }
+
+private:
+	void OnListings(const TArray<FThirdwebMarketplaceDirectListing>& Page);
+	void OnAuctions(const TArray<FThirdwebMarketplaceEnglishAuction>& Page);
+	void OnOffers(const TArray<FThirdwebMarketplaceOffer>& Page);
+	void OnSectionComplete();
+	void OnSectionError(const FString& Error);
+
+	/** Advances a section's refresh watermark past the highest ID of the page */
+	template <typename T>
+	static void Advance(const TArray<T>& Page, int32& Loaded)
+	{
+		for (const T& Entry : Page)
+		{
+			Loaded = FMath::Max(Loaded, FCString::Atoi(*Entry.Id) + 1);
+		}
+	}
+
+	int64 ChainId;
+	FString ContractAddress;
+
+	TThirdwebMarketplaceEntryIndex<FThirdwebMarketplaceDirectListing> Listings;
+	TThirdwebMarketplaceEntryIndex<FThirdwebMarketplaceEnglishAuction> Auctions;
+	TThirdwebMarketplaceEntryIndex<FThirdwebMarketplaceOffer> Offers;
+
+	/** First ID not yet fetched, per section */
+	int32 LoadedListings = 0;
+	int32 LoadedAuctions = 0;
+	int32 LoadedOffers = 0;
+
+	int32 PendingSections = 0;
+	bool bRefreshingFull = false;
+	FString RefreshError;
+	TArray<FSimpleDelegate> CompleteDelegates;
+	TArray<FStringDelegate> ErrorDelegates;
+
+	/** Full refresh waiting for the incremental one running */
+	TWeakObjectPtr<const UObject> QueuedFullOuter;
+	TArray<FSimpleDelegate> QueuedFullCompleteDelegates;
+	TArray<FStringDelegate> QueuedFullErrorDelegates;
+};
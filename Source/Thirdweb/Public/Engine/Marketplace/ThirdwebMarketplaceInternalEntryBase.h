@@ -9,6 +9,7 @@
 
 class FJsonObject;
 class FJsonValue;
+class FThirdwebJsonReader;
 
 USTRUCT(BlueprintType)
 struct THIRDWEB_API FThirdwebMarketplaceInternalEntryBase
@@ -51,4 +52,7 @@ struct THIRDWEB_API FThirdwebMarketplaceInternalEntryBase
   	}
 protected:
 	void Load(const FThirdwebMarketplaceInternalEntryBase& Base);
+
+	/** Reads a field shared by every marketplace entry. False if the key is not one of them, leaving the value unread */
+	bool ReadField(FThirdwebJsonReader& Reader, const FUtf8StringView Key);
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "ThirdwebMacros.h"
 #include "Engine/ThirdwebAsset.h"
+#include "Engine/Marketplace/ThirdwebMarketplaceIndex.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "ThirdwebMarketplaceSubsystem.generated.h"
 
@@ -36,6 +37,34 @@ public:
 	UFUNCTION(BlueprintPure, meta=(WorldContext="WorldContextObject"), Category="Thirdweb|Marketplace")
 	static TArray<UThirdwebMarketplace*> GetAllMarketplaces(const UObject* WorldContextObject);
 
+	/**
+	 * Fetches the entries created since the last refresh into the local index of a registered marketplace.
+	 *
+	 * @param bFull Refetch every entry, picking up status and price changes of entries already indexed.
+	 */
+	static void RefreshIndex(
+		const UObject* WorldContextObject,
+		const UThirdwebMarketplace* Marketplace,
+		const bool bFull,
+		const FSimpleDelegate& CompleteDelegate,
+		const FStringDelegate& ErrorDelegate
+	);
+
+	/** Filters and sorts the locally indexed listings of a registered marketplace */
+	UFUNCTION(BlueprintPure, meta=(WorldContext="WorldContextObject"), Category="Thirdweb|Marketplace|Index")
+	static TArray<FThirdwebMarketplaceDirectListing> QueryListings(const UObject* WorldContextObject, const UThirdwebMarketplace* Marketplace, const FThirdwebMarketplaceQuery& Query);
+
+	/** Filters and sorts the locally indexed auctions of a registered marketplace */
+	UFUNCTION(BlueprintPure, meta=(WorldContext="WorldContextObject"), Category="Thirdweb|Marketplace|Index")
+	static TArray<FThirdwebMarketplaceEnglishAuction> QueryAuctions(const UObject* WorldContextObject, const UThirdwebMarketplace* Marketplace, const FThirdwebMarketplaceQuery& Query);
+
+	/** Filters and sorts the locally indexed offers of a registered marketplace */
+	UFUNCTION(BlueprintPure, meta=(WorldContext="WorldContextObject"), Category="Thirdweb|Marketplace|Index")
+	static TArray<FThirdwebMarketplaceOffer> QueryOffers(const UObject* WorldContextObject, const UThirdwebMarketplace* Marketplace, const FThirdwebMarketplaceQuery& Query);
+
+	/** Local index of a registered marketplace, or null */
+	static TSharedPtr<FThirdwebMarketplaceIndex> FindIndex(const UObject* WorldContextObject, const UThirdwebMarketplace* Marketplace);
+
 	static UThirdwebMarketplaceSubsystem* Get(const UObject* WorldContextObject);
 
 protected:
@@ -164,4 +193,7 @@ protected:
 private:
 	/** ChainId -> Address -> Instance */
 	TMap<int64, TMap<FString, UThirdwebMarketplace*>> Marketplaces;
+
+	/** ChainId -> Address -> Index of every registered marketplace */
+	TMap<int64, TMap<FString, TSharedRef<FThirdwebMarketplaceIndex>>> Indices;
 };
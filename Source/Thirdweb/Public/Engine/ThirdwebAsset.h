@@ -6,6 +6,7 @@
 
 class FJsonObject;
 class FJsonValue;
+class FThirdwebJsonReader;
 
 USTRUCT(BlueprintType)
 struct THIRDWEB_API FThirdwebAssetCurrencyValue
@@ -28,6 +29,7 @@ struct THIRDWEB_API FThirdwebAssetCurrencyValue
 	FString DisplayValue;
 
 	static FThirdwebAssetCurrencyValue FromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	static FThirdwebAssetCurrencyValue FromJson(FThirdwebJsonReader& Reader);
 };
 
 
@@ -44,6 +46,7 @@ struct THIRDWEB_API FThirdwebAssetAttribute
 
 	static FThirdwebAssetAttribute FromJson(const TSharedPtr<FJsonObject>& JsonObject);
 	static TArray<FThirdwebAssetAttribute> FromJson(const TArray<TSharedPtr<FJsonValue>>& JsonArray);
+	static FThirdwebAssetAttribute FromJson(FThirdwebJsonReader& Reader);
 };
 
 
@@ -71,4 +74,5 @@ struct THIRDWEB_API FThirdwebAsset
 	TArray<FThirdwebAssetAttribute> Attributes;
 
 	static FThirdwebAsset FromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	static FThirdwebAsset FromJson(FThirdwebJsonReader& Reader);
 };
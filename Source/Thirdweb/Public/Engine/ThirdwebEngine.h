@@ -8,8 +8,180 @@ struct FThirdwebURLSearchParams;
 #include "Engine/Contract/ThirdwebEngine_Contract.h"
 #include "Engine/Marketplace/ThirdwebEngine_Marketplace.h"
 #include "Engine/Transaction/ThirdwebEngine_Transaction.h"
+#include "ThirdwebMacros.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Internal/ThirdwebJsonReader.h"
+#include "Templates/Function.h"
+
+class FJsonObject;
+class FJsonValue;
 
 namespace ThirdwebEngine
 {
 	FString FormatUrl(const FString& Base, const FString& Endpoint, const FThirdwebURLSearchParams& Params);
+
+	/** Parses an Engine response envelope. Responses shared by coalesced requests are only decoded once */
+	bool ParseResponse(const FHttpResponsePtr& Response, TSharedPtr<FJsonValue>& JsonValue, FString& Error);
+	bool ParseResponse(const FHttpResponsePtr& Response, TSharedPtr<FJsonObject>& JsonObject, FString& Error);
+	bool ParseResponse(const FHttpResponsePtr& Response, TArray<TSharedPtr<FJsonValue>>& JsonArray, FString& Error);
+
+	/**
+	 * Reads an Engine response envelope from raw UTF-8 bytes in a single pass.
+	 *
+	 * @param Content The response body.
+	 * @param ReadResult Called with the reader positioned on the `result` field.
+	 * @param Error The Engine error message on failure.
+	 * @return True if the envelope contained a result and was well formed.
+	 */
+	bool ReadEnvelope(const TConstArrayView<uint8> Content, TFunctionRef<void(FThirdwebJsonReader& Reader)> ReadResult, FString& Error);
+
+	/** Reads an Engine response envelope straight from the UTF-8 body, calling ReadResult on the `result` field */
+	bool ReadResponse(const FHttpResponsePtr& Response, TFunctionRef<void(FThirdwebJsonReader& Reader)> ReadResult, FString& Error);
+
+	/**
+	 * Runs Decode on a worker task if the response is larger than UThirdwebRuntimeSettings::GetEngineAsyncDecodeThreshold(),
+	 * then runs the continuation it returns on the game thread. Smaller responses are handled inline.
+	 */
+	void DecodeAsync(const FHttpResponsePtr& Response, TUniqueFunction<TUniqueFunction<void()>()>&& Decode);
+
+	/** Runs Function on a worker task */
+	void RunOnWorker(TUniqueFunction<void()>&& Function);
+
+	/** Runs Function on the game thread, inline if already there. Functions dispatched from one thread run in order */
+	void RunOnGameThread(TUniqueFunction<void()>&& Function);
+
+	/**
+	 * Parses an Engine response envelope and converts it with Decoder, off the game thread for large responses.
+	 * Only the decoded result is passed back to the game thread, where the delegates are executed.
+	 *
+	 * @tparam TJson The JSON type of the `result` field, as accepted by ParseResponse.
+	 * @param Response The response passed to the completion delegate.
+	 * @param Decoder Converts the parsed JSON into the delegate payload. Must be safe to call from any thread.
+	 * @param SuccessDelegate Executed with the decoded result.
+	 * @param ErrorDelegate Executed with the Engine error message.
+	 */
+	template <typename TJson, typename TDecoder, typename TDelegate>
+	void ParseResponseAsync(const FHttpResponsePtr& Response, TDecoder&& Decoder, const TDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
+	{
+		DecodeAsync(Response, [Response, Decoder = Forward<TDecoder>(Decoder), SuccessDelegate, ErrorDelegate]() -> TUniqueFunction<void()>
+		{
+			FString Error;
+			if (TJson Json; ParseResponse(Response, Json, Error))
+			{
+				return [Result = Decoder(Json), SuccessDelegate]() { EXECUTE_IF_BOUND(SuccessDelegate, Result) };
+			}
+			return [Error = MoveTemp(Error), ErrorDelegate]() { EXECUTE_IF_BOUND(ErrorDelegate, Error) };
+		});
+	}
+
+	/**
+	 * Single pass counterpart of ParseResponseAsync for results with a FromJson(FThirdwebJsonReader&) decoder.
+	 * The `result` field is decoded straight from the UTF-8 body, off the game thread for large responses.
+	 *
+	 * @param Response The response passed to the completion delegate.
+	 * @param Decoder Reads the delegate payload from the reader. Must be safe to call from any thread.
+	 * @param SuccessDelegate Executed with the decoded result.
+	 * @param ErrorDelegate Executed with the Engine error message.
+	 */
+	template <typename TDecoder, typename TDelegate>
+	void ReadResponseAsync(const FHttpResponsePtr& Response, TDecoder&& Decoder, const TDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate)
+	{
+		DecodeAsync(Response, [Response, Decoder = Forward<TDecoder>(Decoder), SuccessDelegate, ErrorDelegate]() -> TUniqueFunction<void()>
+		{
+			std::decay_t<decltype(Decoder(DeclVal<FThirdwebJsonReader&>()))> Result;
+			FString Error;
+			if (ReadResponse(Response, [&Decoder, &Result](FThirdwebJsonReader& Reader) { Result = Decoder(Reader); }, Error))
+			{
+				return [Result = MoveTemp(Result), SuccessDelegate]() { EXECUTE_IF_BOUND(SuccessDelegate, Result) };
+			}
+			return [Error = MoveTemp(Error), ErrorDelegate]() { EXECUTE_IF_BOUND(ErrorDelegate, Error) };
+		});
+	}
+
+	/** State of a ReadResponseBatchesAsync call, shared by the worker passes and the game thread callbacks */
+	template <typename T, typename TBatchDelegate>
+	struct TResponseBatchReader : TSharedFromThis<TResponseBatchReader<T, TBatchDelegate>, ESPMode::ThreadSafe>
+	{
+		FHttpResponsePtr Response;
+		int32 BatchSize = 1;
+		TBatchDelegate BatchDelegate;
+		FSimpleDelegate CompleteDelegate;
+
+		/** Body offsets of the object elements of the `result` array */
+		TArray<int32> Offsets;
+		int32 Next = 0;
+
+		/** Decodes the next batch on a worker. The game thread asks for the one after once it has consumed this one */
+		void DecodeNext()
+		{
+			RunOnWorker([Self = this->AsShared()]()
+			{
+				const TConstArrayView<uint8> Content = Self->Response->GetContent();
+				const int32 End = FMath::Min(Self->Next + Self->BatchSize, Self->Offsets.Num());
+				TArray<T> Batch;
+				Batch.Reserve(End - Self->Next);
+				for (; Self->Next < End; Self->Next++)
+				{
+					FThirdwebJsonReader Reader(Content.RightChop(Self->Offsets[Self->Next]));
+					Batch.Emplace(T::FromJson(Reader));
+				}
+				RunOnGameThread([Self, Batch = MoveTemp(Batch)]()
+				{
+					EXECUTE_IF_BOUND(Self->BatchDelegate, Batch)
+					if (Self->Next < Self->Offsets.Num())
+					{
+						Self->DecodeNext();
+						return;
+					}
+					Self->CompleteDelegate.ExecuteIfBound();
+				});
+			});
+		}
+	};
+
+	/**
+	 * Streams the `result` array of an Engine response to BatchDelegate in batches of up to BatchSize elements, decoded
+	 * with T::FromJson(FThirdwebJsonReader&) on worker tasks. A first pass validates the envelope and indexes the elements
+	 * without decoding them, then every batch is decoded only after the game thread has consumed the previous one, so at
+	 * most one decoded batch is ever waiting on the game thread and no worker blocks on it.
+	 *
+	 * CompleteDelegate fires after the last batch. If the payload is malformed, ErrorDelegate fires instead of any batch.
+	 */
+	template <typename T, typename TBatchDelegate>
+	void ReadResponseBatchesAsync(const FHttpResponsePtr& Response, const int32 BatchSize, const TBatchDelegate& BatchDelegate, const FSimpleDelegate& CompleteDelegate, const FStringDelegate& ErrorDelegate)
+	{
+		const TSharedRef<TResponseBatchReader<T, TBatchDelegate>, ESPMode::ThreadSafe> State = MakeShared<TResponseBatchReader<T, TBatchDelegate>, ESPMode::ThreadSafe>();
+		State->Response = Response;
+		State->BatchSize = FMath::Max(1, BatchSize);
+		State->BatchDelegate = BatchDelegate;
+		State->CompleteDelegate = CompleteDelegate;
+
+		RunOnWorker([State, ErrorDelegate]()
+		{
+			FString Error;
+			const bool bSuccess = ReadResponse(State->Response, [&State](FThirdwebJsonReader& Reader)
+			{
+				Reader.ReadArray([&State, &Reader]()
+				{
+					if (Reader.Peek() == EJson::Object)
+					{
+						State->Offsets.Add(Reader.GetOffset());
+						Reader.Skip();
+					}
+				});
+			}, Error);
+
+			if (!bSuccess)
+			{
+				RunOnGameThread([Error, ErrorDelegate]() { EXECUTE_IF_BOUND(ErrorDelegate, Error) });
+				return;
+			}
+			if (State->Offsets.Num() == 0)
+			{
+				RunOnGameThread([State]() { State->CompleteDelegate.ExecuteIfBound(); });
+				return;
+			}
+			State->DecodeNext();
+		});
+	}
 }
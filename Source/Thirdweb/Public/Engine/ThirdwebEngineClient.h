@@ -0,0 +1,195 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/ThirdwebEngineEndpoints.h"
+#include "Engine/ThirdwebEngineResponseCache.h"
+#include "HAL/CriticalSection.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Templates/Function.h"
+
+class FJsonValue;
+class FThirdwebJsonReader;
+
+/**
+ * Shared HTTP client used by every ThirdwebEngine namespace.
+ *
+ * Requests are sent immediately while fewer than UThirdwebRuntimeSettings::GetEngineMaxConcurrentRequests() are in flight,
+ * otherwise they are queued in FIFO order and sent as slots free up. Engine requests ask for keep-alive connections so
+ * a bounded number of concurrent requests lets the HTTP backend reuse its pooled connections instead of opening new ones.
+ *
+ * Identical GET requests (same URL and authorization) that overlap are coalesced into a single network request, and the
+ * response is delivered to every waiting delegate. ParseResponse decodes a coalesced response once for all of them.
+ *
+ * Successful GETs to endpoints with a TTL are kept in a FThirdwebEngineResponseCache and served synchronously from it,
+ * so a cached read completes in the same frame it was issued. Successful writes invalidate the entries of their contract.
+ *
+ * Idempotent requests (GETs and POSTs carrying an `x-idempotency-key`) that fail with a dropped connection, 408, 429 or
+ * 5xx gateway errors are retried with jittered exponential backoff, honouring `Retry-After`.
+ *
+ * Every send is routed to one of the configured Engine instances by FThirdwebEngineEndpoints, which also owns the
+ * per-host circuit breakers. Requests fail fast while every circuit is open. Reads that are still outstanding after
+ * UThirdwebRuntimeSettings::GetEngineHedgeDelay() are hedged to a second instance and the first answer wins.
+ */
+class THIRDWEB_API FThirdwebEngineClient
+{
+public:
+	/** Process-wide client instance */
+	static FThirdwebEngineClient& Get();
+
+	/**
+	 * Sends the request, or queues it if the in-flight cap has been reached.
+	 * The completion delegate must already be bound and is invoked exactly as if the request had been processed directly.
+	 *
+	 * @param Request The fully configured Engine request.
+	 */
+	void ProcessRequest(const TSharedRef<IHttpRequest>& Request);
+
+	/**
+	 * Parses the Engine response envelope, reusing the decoded result if the response is shared by coalesced requests.
+	 *
+	 * @param Response The response passed to the completion delegate.
+	 * @param JsonValue The `result` field of the envelope on success.
+	 * @param Error The Engine error message on failure.
+	 * @return True if the response contained a result.
+	 */
+	bool ParseResponse(const FHttpResponsePtr& Response, TSharedPtr<FJsonValue>& JsonValue, FString& Error);
+
+	/**
+	 * Reads the Engine response envelope straight from the UTF-8 body in a single pass, without building a JSON DOM.
+	 *
+	 * @param Response The response passed to the completion delegate.
+	 * @param ReadResult Called with the reader positioned on the `result` field of the envelope.
+	 * @param Error The Engine error message on failure.
+	 * @return True if the response contained a result and was well formed.
+	 */
+	bool ReadResponse(const FHttpResponsePtr& Response, TFunctionRef<void(FThirdwebJsonReader& Reader)> ReadResult, FString& Error);
+
+	/** Opens a connection to the configured Engine instance ahead of the first real request */
+	void Warmup();
+
+	/** Number of requests waiting for an in-flight slot */
+	int32 GetQueueDepth() const;
+
+	/** Number of requests currently on the wire */
+	int32 GetInFlightCount() const;
+
+	/** Total number of requests that were served by joining an identical in-flight request */
+	int64 GetCoalescedCount() const;
+
+	/**
+	 * Drops cached responses of a contract.
+	 *
+	 * @param ContractAddress The contract whose reads should be refetched. Drops the whole cache if empty.
+	 */
+	void InvalidateCache(const FString& ContractAddress = TEXT(""));
+
+	/** Hit/miss counters and memory usage of the response cache */
+	FThirdwebEngineResponseCache::FStats GetCacheStats() const;
+
+	/** True if the circuit breaker of the host is open and its requests are failing fast */
+	bool IsCircuitOpen(const FString& Host) const;
+
+	/** Load and health of every configured Engine instance */
+	TArray<FThirdwebEngineEndpoints::FStats> GetEndpointStats() const;
+
+private:
+	/** A request waiting for, or holding, an in-flight slot */
+	struct FPendingRequest
+	{
+		TSharedRef<IHttpRequest> Request;
+		/** Invoked once the final attempt completes */
+		FHttpRequestCompleteDelegate OnComplete;
+		int32 Attempt = 0;
+	};
+
+	/** A single attempt of a request, which may be sent to more than one endpoint when hedged */
+	struct FAttempt
+	{
+		explicit FAttempt(const FPendingRequest& InPending) : Pending(InPending), Url(InPending.Request->GetURL()) {}
+
+		FPendingRequest Pending;
+		/** URL built against the primary base URL */
+		FString Url;
+		TArray<TSharedRef<IHttpRequest>> Sends;
+		/** Endpoint of the first send, which a hedge must avoid */
+		FString FirstBaseUrl;
+		int32 Outstanding = 0;
+		bool bDone = false;
+	};
+
+	/**
+	 * Decoded envelope of a response delivered to several waiters, either coalesced or served from the cache.
+	 * Waiters and bPinned are guarded by the client Lock, the rest by the result Lock
+	 */
+	struct FSharedResult
+	{
+		FCriticalSection Lock;
+		TSharedPtr<FJsonValue> JsonValue;
+		FString Error;
+		bool bSuccess = false;
+		bool bParsed = false;
+		int32 Waiters = 0;
+		/** Kept alive while the response is cached */
+		bool bPinned = false;
+		double CreatedAt = 0.0;
+	};
+
+	FThirdwebEngineClient() = default;
+
+	static bool IsCoalescable(const TSharedRef<IHttpRequest>& Request);
+	static FString MakeCoalescingKey(const TSharedRef<IHttpRequest>& Request);
+	static bool ParseResponseInternal(const FHttpResponsePtr& Response, TSharedPtr<FJsonValue>& JsonValue, FString& Error);
+	static bool IsSuccessful(const FHttpResponsePtr& Response, const bool bConnectedSuccessfully);
+	static bool IsIdempotent(const FHttpRequestPtr& Request);
+	static bool IsRetryable(const FHttpResponsePtr& Response, const bool bConnectedSuccessfully);
+	static bool IsHostFailure(const FHttpResponsePtr& Response, const bool bConnectedSuccessfully);
+	static float GetRetryDelay(const FHttpResponsePtr& Response, const int32 Attempt);
+
+	/** True if another request may be sent right now. Must be called with Lock held */
+	bool HasFreeSlot() const;
+
+	void Enqueue(FPendingRequest&& Pending);
+	void Dispatch(const FPendingRequest& Pending);
+	bool Send(const TSharedRef<FAttempt, ESPMode::ThreadSafe>& Attempt, const TSharedRef<IHttpRequest>& Request, const FString& ExcludeBaseUrl = TEXT(""));
+	void Hedge(const TSharedRef<FAttempt, ESPMode::ThreadSafe>& Attempt);
+	void OnSendComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, TSharedRef<FAttempt, ESPMode::ThreadSafe> Attempt, FString BaseUrl, bool bProbe, double StartTime);
+	void OnAttemptComplete(const FPendingRequest& Pending, FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully);
+	void OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FHttpRequestCompleteDelegate Delegate);
+	void OnCoalescedRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bConnectedSuccessfully, FString Key);
+	void ScheduleRetry(FPendingRequest&& Pending, const float Delay);
+	void ReleaseSlot();
+	void DispatchPending();
+
+	/** Completes the request from the cache if possible, refreshing stale entries in the background */
+	bool ServeFromCache(const TSharedRef<IHttpRequest>& Request, const FHttpRequestCompleteDelegate& Delegate);
+	void Revalidate(const TSharedRef<IHttpRequest>& Request);
+	void StoreInCache(const FString& Url, const FHttpResponsePtr& Response);
+	void InvalidateContractsInUrl(const FString& Url);
+	void UnpinRemoved(const TArray<FHttpResponsePtr>& Removed);
+
+	/** Makes a fresh copy of a request, without its completion delegate */
+	static TSharedRef<IHttpRequest> CloneRequest(const TSharedRef<IHttpRequest>& Request);
+
+	void ShareResult(const FHttpResponsePtr& Response, const int32 Waiters, const bool bPin = false);
+	void ReleaseSharedResult(const FHttpResponsePtr& Response);
+	void UnpinSharedResult(const FHttpResponsePtr& Response);
+
+	mutable FCriticalSection Lock;
+	/** FIFO of requests waiting for a free slot. Entries before PendingHead have been dispatched already */
+	TArray<FPendingRequest> PendingRequests;
+	int32 PendingHead = 0;
+	int32 InFlightCount = 0;
+
+	FThirdwebEngineEndpoints Endpoints;
+
+	/** Completion delegates of every caller waiting on an in-flight GET, keyed by URL and authorization */
+	TMap<FString, TArray<FHttpRequestCompleteDelegate>> InFlightReads;
+	int64 CoalescedCount = 0;
+
+	/** Keyed by a strong reference, so that no later response can reuse the address of one still in the map */
+	TMap<FHttpResponsePtr, TSharedRef<FSharedResult, ESPMode::ThreadSafe>> SharedResults;
+
+	FThirdwebEngineResponseCache ResponseCache;
+};
@@ -0,0 +1,89 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/CriticalSection.h"
+
+/**
+ * Health-aware set of Engine instances, built from UThirdwebRuntimeSettings::GetEngineBaseUrls().
+ *
+ * Every send is assigned to the healthy endpoint with the fewest outstanding requests. Endpoints whose recent error
+ * rate or latency exceed the configured limits are ejected for a while, as long as another endpoint remains. Each
+ * endpoint also has a circuit breaker that opens after consecutive failures and lets a single probe through once
+ * its cooldown has elapsed.
+ *
+ * URLs are always built against the primary base URL and rewritten to the chosen endpoint right before sending, so
+ * caching and coalescing keep working on canonical URLs.
+ */
+class THIRDWEB_API FThirdwebEngineEndpoints
+{
+public:
+	struct FStats
+	{
+		FString BaseUrl;
+		int32 Outstanding = 0;
+		float ErrorRate = 0.0f;
+		float Latency = 0.0f;
+		bool bEjected = false;
+		bool bCircuitOpen = false;
+	};
+
+	/** True if at least one endpoint is accepting requests */
+	bool HasAvailable();
+
+	/**
+	 * Picks the endpoint for the next send and counts it as outstanding.
+	 *
+	 * @param Exclude Base URL that must not be picked, e.g. the one a hedged request is already waiting on.
+	 * @param bOutProbe Set to true if the send is the probe of a half open circuit.
+	 * @return The chosen base URL, or an empty string if no endpoint is accepting requests.
+	 */
+	FString Acquire(const FString& Exclude, bool& bOutProbe);
+
+	/**
+	 * Releases a send started with Acquire and records its outcome.
+	 *
+	 * @param BaseUrl The base URL returned by Acquire.
+	 * @param bFailure True if the send failed to connect or returned a server error.
+	 * @param Latency Seconds between sending and completion.
+	 * @param bCancelled True if the send was cancelled, in which case its outcome is not recorded.
+	 * @param bProbe The bOutProbe value Acquire returned for the send.
+	 */
+	void Release(const FString& BaseUrl, const bool bFailure, const double Latency, const bool bCancelled, const bool bProbe);
+
+	/** Rewrites a URL built against the primary base URL to target another endpoint */
+	static FString Rewrite(const FString& Url, const FString& BaseUrl);
+
+	/** Number of configured endpoints */
+	int32 Num();
+
+	TArray<FStats> GetStats() const;
+
+	/** True if the circuit breaker of the host is open */
+	bool IsCircuitOpen(const FString& Host) const;
+
+private:
+	struct FEndpoint
+	{
+		FString BaseUrl;
+		int32 Outstanding = 0;
+		int32 Samples = 0;
+		double ErrorRate = 0.0;
+		double Latency = 0.0;
+		double EjectedUntil = 0.0;
+		int32 ConsecutiveFailures = 0;
+		double OpenUntil = 0.0;
+		bool bProbing = false;
+	};
+
+	/** Picks up changes to the configured base URLs. Must be called with Lock held */
+	void Refresh();
+
+	/** True if the circuit of the endpoint lets a request through */
+	static bool IsCircuitAccepting(const FEndpoint& Endpoint, const double Now);
+
+	FEndpoint* Find(const FString& BaseUrl);
+
+	mutable FCriticalSection Lock;
+	TArray<FEndpoint> Endpoints;
+};
@@ -0,0 +1,286 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "ThirdwebLog.h"
+#include "ThirdwebMacros.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+DECLARE_DELEGATE_TwoParams(FThirdwebEnginePagerProgressDelegate, const int32 /* Loaded */, const int32 /* Total, INDEX_NONE if unknown */)
+
+struct FThirdwebEnginePagerOptions
+{
+	/** Entries requested per page */
+	int32 PageSize = 100;
+
+	/** Pages requested at once. Each page still goes through the shared Engine client and its concurrency cap */
+	int32 MaxConcurrentPages = 4;
+
+	/** Deliver pages in index order. Otherwise pages are delivered as they arrive */
+	bool bInOrder = true;
+
+	/** Stop after this many entries. 0 = Everything */
+	int32 MaxEntries = 0;
+};
+
+/**
+ * Walks a paginated Engine listing with several page requests in flight.
+ *
+ * If a total fetcher is provided, the number of pages is derived from it up front. Otherwise pages are requested
+ * speculatively and the first page that comes back short marks the end. Pages are handed to the page delegate on the
+ * game thread, either in index order or as they arrive, followed by a progress update.
+ *
+ * The pager keeps itself alive until it completes, fails or is cancelled, so callers only need to hold on to it to
+ * cancel early. Errors after the automatic retries of FThirdwebEngineClient stop the whole walk.
+ *
+ * The walk belongs to its outer, but fetchers bind their requests to the transient package so that every request
+ * answers. The pager checks the outer instead, before each request and as each answer arrives, and fails the walk once
+ * it is gone. Either way the walk ends and the pager releases itself.
+ */
+template <typename T>
+class TThirdwebEnginePager : public TSharedFromThis<TThirdwebEnginePager<T>>
+{
+public:
+	using FPageDelegate = TDelegate<void(const TArray<T>&)>;
+
+	/** Requests a single page, identified by its zero based index */
+	using FFetchPage = TFunction<void(const int32 PageIndex, const int32 PageSize, const FPageDelegate& Success, const FStringDelegate& Error)>;
+
+	/** Requests the total number of entries that can be paged through */
+	using FFetchTotal = TFunction<void(const FInt32Delegate& Success, const FStringDelegate& Error)>;
+
+	/** @param InOuter Owner of the walk, or null for a walk nothing owns */
+	static TSharedRef<TThirdwebEnginePager> Create(
+		const UObject* InOuter,
+		FFetchPage&& InFetchPage,
+		FFetchTotal&& InFetchTotal,
+		const FThirdwebEnginePagerOptions& InOptions,
+		const FPageDelegate& InPageDelegate,
+		const FThirdwebEnginePagerProgressDelegate& InProgressDelegate,
+		const FSimpleDelegate& InCompleteDelegate,
+		const FStringDelegate& InErrorDelegate
+	)
+	{
+		TSharedRef<TThirdwebEnginePager> Pager = MakeShareable(new TThirdwebEnginePager());
+		Pager->Outer = InOuter;
+		Pager->bHasOuter = InOuter != nullptr;
+		Pager->FetchPage = MoveTemp(InFetchPage);
+		Pager->FetchTotal = MoveTemp(InFetchTotal);
+		Pager->Options = InOptions;
+		Pager->Options.PageSize = FMath::Max(1, InOptions.PageSize);
+		Pager->Options.MaxConcurrentPages = FMath::Max(1, InOptions.MaxConcurrentPages);
+		Pager->PageDelegate = InPageDelegate;
+		Pager->ProgressDelegate = InProgressDelegate;
+		Pager->CompleteDelegate = InCompleteDelegate;
+		Pager->ErrorDelegate = InErrorDelegate;
+		return Pager;
+	}
+
+	void Start()
+	{
+		if (bRunning || bFinished)
+		{
+			return;
+		}
+		bRunning = true;
+		Self = this->AsShared();
+		if (FailIfOuterStale())
+		{
+			return;
+		}
+		if (FetchTotal)
+		{
+			FetchTotal(
+				FInt32Delegate::CreateSP(this->AsShared(), &TThirdwebEnginePager::OnTotal),
+				FStringDelegate::CreateSP(this->AsShared(), &TThirdwebEnginePager::OnError)
+			);
+		}
+		else
+		{
+			if (Options.MaxEntries > 0)
+			{
+				EndPage = FMath::DivideAndRoundUp(Options.MaxEntries, Options.PageSize);
+			}
+			Dispatch();
+		}
+	}
+
+	/** Stops requesting pages and drops the ones still in flight. No further delegates fire */
+	void Cancel()
+	{
+		if (!bFinished)
+		{
+			TW_LOG(Verbose, TEXT("TThirdwebEnginePager::Cancel::Delivered=%d"), Delivered)
+		}
+		Finish();
+	}
+
+	bool IsRunning() const { return bRunning && !bFinished; }
+	int32 GetDelivered() const { return Delivered; }
+
+	/** Total number of entries, INDEX_NONE until known */
+	int32 GetTotal() const { return Total; }
+
+private:
+	TThirdwebEnginePager() = default;
+
+	void OnTotal(const int32 InTotal)
+	{
+		if (bFinished || FailIfOuterStale())
+		{
+			return;
+		}
+		Total = FMath::Max(0, InTotal);
+		if (Options.MaxEntries > 0)
+		{
+			Total = FMath::Min(Total, Options.MaxEntries);
+		}
+		EndPage = FMath::DivideAndRoundUp(Total, Options.PageSize);
+		TW_LOG(Verbose, TEXT("TThirdwebEnginePager::OnTotal::Total=%d::Pages=%d"), Total, EndPage)
+		Dispatch();
+	}
+
+	void Dispatch()
+	{
+		if (FailIfOuterStale())
+		{
+			return;
+		}
+		while (!bFinished && InFlight < Options.MaxConcurrentPages && (EndPage == INDEX_NONE || NextPage < EndPage))
+		{
+			const int32 PageIndex = NextPage++;
+			InFlight++;
+			FetchPage(
+				PageIndex,
+				Options.PageSize,
+				FPageDelegate::CreateSP(this->AsShared(), &TThirdwebEnginePager::OnPage, PageIndex),
+				FStringDelegate::CreateSP(this->AsShared(), &TThirdwebEnginePager::OnError)
+			);
+		}
+		if (!bFinished && InFlight == 0 && EndPage != INDEX_NONE && NextDelivery >= EndPage)
+		{
+			const FSimpleDelegate Complete = CompleteDelegate;
+			Finish();
+			Complete.ExecuteIfBound();
+		}
+	}
+
+	void OnPage(const TArray<T>& Entries, const int32 PageIndex)
+	{
+		if (bFinished || FailIfOuterStale())
+		{
+			return;
+		}
+		InFlight--;
+		if (Total == INDEX_NONE && Entries.Num() < Options.PageSize)
+		{
+			// Short page: nothing exists past it
+			EndPage = EndPage == INDEX_NONE ? PageIndex + 1 : FMath::Min(EndPage, PageIndex + 1);
+		}
+
+		if (Options.bInOrder)
+		{
+			Ready.Add(PageIndex, Entries);
+			while (!bFinished && Ready.Contains(NextDelivery) && (EndPage == INDEX_NONE || NextDelivery < EndPage))
+			{
+				TArray<T> Page;
+				Ready.RemoveAndCopyValue(NextDelivery, Page);
+				NextDelivery++;
+				Deliver(MoveTemp(Page));
+			}
+		}
+		else if (EndPage == INDEX_NONE || PageIndex < EndPage)
+		{
+			NextDelivery++;
+			Deliver(CopyTemp(Entries));
+		}
+		else
+		{
+			NextDelivery++;
+		}
+		Dispatch();
+	}
+
+	void Deliver(TArray<T>&& Page)
+	{
+		if (Options.MaxEntries > 0 && Delivered >= Options.MaxEntries)
+		{
+			return;
+		}
+		if (Options.MaxEntries > 0 && Delivered + Page.Num() > Options.MaxEntries)
+		{
+			Page.SetNum(FMath::Max(0, Options.MaxEntries - Delivered));
+		}
+		Delivered += Page.Num();
+		// Keep the pager alive even if a delegate cancels it
+		const TSharedRef<TThirdwebEnginePager> Pin = this->AsShared();
+		EXECUTE_IF_BOUND(PageDelegate, Page)
+		if (!bFinished)
+		{
+			EXECUTE_IF_BOUND(ProgressDelegate, Delivered, Total)
+		}
+		if (Options.MaxEntries > 0 && Delivered >= Options.MaxEntries)
+		{
+			EndPage = FMath::Min(EndPage == INDEX_NONE ? NextDelivery : EndPage, NextDelivery);
+		}
+	}
+
+	void OnError(const FString& Error)
+	{
+		if (bFinished)
+		{
+			return;
+		}
+		TW_LOG(Warning, TEXT("TThirdwebEnginePager::OnError::%s"), *Error)
+		const FStringDelegate Failed = ErrorDelegate;
+		Finish();
+		EXECUTE_IF_BOUND(Failed, Error)
+	}
+
+	/** Fails the walk if its outer is gone. Returns whether it did */
+	bool FailIfOuterStale()
+	{
+		if (bFinished || !bHasOuter || Outer.IsValid())
+		{
+			return false;
+		}
+		OnError(TEXT("Outer is no longer valid"));
+		return true;
+	}
+
+	void Finish()
+	{
+		bFinished = true;
+		Ready.Empty();
+		Self.Reset();
+	}
+
+	TWeakObjectPtr<const UObject> Outer;
+	bool bHasOuter = false;
+	FFetchPage FetchPage;
+	FFetchTotal FetchTotal;
+	FThirdwebEnginePagerOptions Options;
+	FPageDelegate PageDelegate;
+	FThirdwebEnginePagerProgressDelegate ProgressDelegate;
+	FSimpleDelegate CompleteDelegate;
+	FStringDelegate ErrorDelegate;
+
+	int32 Total = INDEX_NONE;
+	/** One past the last page to request, INDEX_NONE until known */
+	int32 EndPage = INDEX_NONE;
+	int32 NextPage = 0;
+	/** Pages delivered (or dropped past the end) so far, in index order when bInOrder is set */
+	int32 NextDelivery = 0;
+	int32 InFlight = 0;
+	int32 Delivered = 0;
+	bool bRunning = false;
+	bool bFinished = false;
+
+	/** Pages that arrived ahead of their turn */
+	TMap<int32, TArray<T>> Ready;
+
+	/** Held while running so callers may fire and forget */
+	TSharedPtr<TThirdwebEnginePager> Self;
+};
@@ -0,0 +1,89 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/List.h"
+#include "HAL/CriticalSection.h"
+#include "Interfaces/IHttpResponse.h"
+
+/**
+ * Memory-bounded LRU cache of successful Engine read responses, keyed by the request URL as built by FormatUrl.
+ *
+ * The TTL of an entry is resolved from its endpoint (the last path segment of the URL) via UThirdwebRuntimeSettings.
+ * Expired entries may still be served for UThirdwebRuntimeSettings::GetEngineCacheStaleWhileRevalidate() seconds,
+ * during which the first lookup asks the caller to refresh the entry in the background.
+ */
+class THIRDWEB_API FThirdwebEngineResponseCache
+{
+public:
+	enum class ELookup : uint8
+	{
+		Miss,
+		Fresh,
+		Stale
+	};
+
+	struct FStats
+	{
+		int64 Hits = 0;
+		int64 StaleHits = 0;
+		int64 Misses = 0;
+		int64 Evictions = 0;
+		int64 Bytes = 0;
+		int32 Entries = 0;
+	};
+
+	/** Seconds a response of this URL may be cached for. 0 if its endpoint is not cacheable */
+	static float GetTTL(const FString& Url);
+
+	/**
+	 * Looks up a cached response.
+	 *
+	 * @param Url The request URL.
+	 * @param OutResponse The cached response on a hit.
+	 * @param bOutShouldRevalidate Set if the entry is stale and nobody is refreshing it yet.
+	 * @return Whether the lookup missed, hit a fresh entry or hit a stale one.
+	 */
+	ELookup Find(const FString& Url, FHttpResponsePtr& OutResponse, bool& bOutShouldRevalidate);
+
+	/**
+	 * Stores a response, replacing any previous entry for the URL and evicting the least recently used entries over budget.
+	 *
+	 * @param Url The request URL.
+	 * @param Response The successful response.
+	 * @param TTL Seconds the response is fresh for.
+	 * @param OutRemoved Responses that are no longer referenced by the cache.
+	 * @return False if the response was not cached, e.g. because it is larger than the memory budget.
+	 */
+	bool Put(const FString& Url, const FHttpResponsePtr& Response, const float TTL, TArray<FHttpResponsePtr>& OutRemoved);
+
+	/**
+	 * Drops every entry whose URL references the contract address. Drops everything if the address is empty.
+	 *
+	 * @param ContractAddress The contract to invalidate.
+	 * @param OutRemoved Responses that are no longer referenced by the cache.
+	 */
+	void Invalidate(const FString& ContractAddress, TArray<FHttpResponsePtr>& OutRemoved);
+
+	FStats GetStats() const;
+
+private:
+	struct FEntry
+	{
+		FHttpResponsePtr Response;
+		double ExpiresAt = 0.0;
+		int64 Bytes = 0;
+		bool bRevalidating = false;
+		TDoubleLinkedList<FString>::TDoubleLinkedListNode* LruNode = nullptr;
+	};
+
+	/** Must be called with Lock held */
+	void Remove(const FString& Url, TArray<FHttpResponsePtr>& OutRemoved);
+
+	mutable FCriticalSection Lock;
+	TMap<FString, FEntry> Entries;
+
+	/** Most recently used at the head */
+	TDoubleLinkedList<FString> Lru;
+	FStats Stats;
+};
@@ -0,0 +1,27 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "ThirdwebEngineRawTransaction.generated.h"
+
+class FJsonObject;
+
+USTRUCT(BlueprintType, DisplayName="Raw Transaction")
+struct THIRDWEB_API FThirdwebEngineRawTransaction
+{
+	GENERATED_BODY()
+
+	/** The contract or wallet address to send to */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Thirdweb|Engine")
+	FString ToAddress;
+
+	/** Encoded calldata */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Thirdweb|Engine")
+	FString Data;
+
+	/** The amount of native currency to send, in wei */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Thirdweb|Engine")
+	FString Value = TEXT("0");
+
+	TSharedPtr<FJsonObject> ToJson() const;
+};
@@ -0,0 +1,58 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Templates/SharedPointer.h"
+
+class IWebSocket;
+struct FThirdwebEngineTransactionStatusResult;
+
+/**
+ * Pushed transaction status updates from Engine's WebSocket status endpoint.
+ *
+ * Engine streams the status of one queue ID per connection, so every subscription holds its own socket. The number of
+ * sockets is capped by UThirdwebRuntimeSettings::GetEngineTransactionMaxStreams(); Subscribe fails once the cap is
+ * reached and the caller is expected to poll instead. Updates and disconnects are reported on the game thread.
+ */
+class THIRDWEB_API FThirdwebEngineStatusStream
+{
+public:
+	DECLARE_DELEGATE_TwoParams(FStatusDelegate, const FString& /* QueueId */, const FThirdwebEngineTransactionStatusResult& /* Result */)
+	DECLARE_DELEGATE_OneParam(FDisconnectedDelegate, const FString& /* QueueId */)
+
+	FThirdwebEngineStatusStream(const FStatusDelegate& InStatusDelegate, const FDisconnectedDelegate& InDisconnectedDelegate);
+	~FThirdwebEngineStatusStream();
+
+	/** Opens a socket for the queue ID. False if streaming is disabled or every stream is in use */
+	bool Subscribe(const FString& QueueId);
+
+	/** Closes the socket of the queue ID without reporting a disconnect */
+	void Unsubscribe(const FString& QueueId);
+
+	bool IsSubscribed(const FString& QueueId) const { return Sockets.Contains(QueueId); }
+
+	/** True once the socket of the queue ID is open and delivering updates */
+	bool IsConnected(const FString& QueueId) const;
+
+	int32 Num() const { return Sockets.Num(); }
+
+	/** WebSocket URL of the status endpoint of a queue ID, derived from the Engine base URL unless overridden */
+	static FString MakeUrl(const FString& QueueId);
+
+	/** Decodes a status message, which is either a `result` envelope or a bare status object */
+	static bool ParseMessage(const FString& Message, FThirdwebEngineTransactionStatusResult& Result);
+
+private:
+	struct FSocket
+	{
+		TSharedPtr<IWebSocket> Socket;
+		bool bConnected = false;
+	};
+
+	void OnClosed(const FString& QueueId, const FString& Reason);
+	static void Close(FSocket& Socket);
+
+	FStatusDelegate StatusDelegate;
+	FDisconnectedDelegate DisconnectedDelegate;
+	TMap<FString, FSocket> Sockets;
+};
@@ -0,0 +1,78 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/CriticalSection.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Templates/UniquePtr.h"
+
+class IFileHandle;
+
+/**
+ * Append-only record of Engine writes that were sent but not yet answered, keyed by their idempotency key.
+ *
+ * Every journaled write appends one line before its request goes out, and one more once Engine has answered with a queue
+ * ID or rejected it. Lines are handed to the OS as they are written, so they survive a crash of the process but not of
+ * the machine. Replay sends the unanswered writes again with their original idempotency key, which Engine uses to drop
+ * the ones it had already queued. Only a write Engine definitely refused counts as answered without a queue ID; server
+ * errors and throttling leave it pending. Answered writes are dropped from the file whenever it is opened, and whenever
+ * nothing is pending and the file has grown past a few megabytes.
+ *
+ * Journaling is enabled with UThirdwebRuntimeSettings::IsEngineWriteJournalEnabled(). When it is, the module replays the
+ * journal once the engine has started, outside the editor. Blueprints can replay it with Replay Engine Writes.
+ */
+class THIRDWEB_API FThirdwebEngineWriteJournal
+{
+public:
+	DECLARE_DELEGATE_ThreeParams(FReplayDelegate, const FString& /* IdempotencyKey */, const FString& /* QueueId, empty on failure */, const FString& /* Error */)
+
+	/** Journal stored in the Saved directory of the project */
+	static FThirdwebEngineWriteJournal& Get();
+
+	static bool IsEnabled();
+
+	explicit FThirdwebEngineWriteJournal(const FString& InPath);
+	~FThirdwebEngineWriteJournal();
+
+	/** Records a write about to be sent. Only x- headers are kept, the access token is added again on replay */
+	void Append(const FString& IdempotencyKey, const FString& Url, const TMap<FString, FString>& Headers, const FString& Body);
+
+	/** Records that Engine queued the write */
+	void Acknowledge(const FString& IdempotencyKey, const FString& QueueId);
+
+	/** Records that Engine refused the write, so it must not be replayed */
+	void Reject(const FString& IdempotencyKey, const FString& Error);
+
+	/** Whether Engine definitely refused a write. Any other failure may have queued it, so it must stay pending */
+	static bool IsRefused(const FHttpResponsePtr& Response);
+
+	/**
+	 * Sends every unanswered write again with its original idempotency key.
+	 *
+	 * @param Delegate Executed once per replayed write. Writes that could not reach Engine stay in the journal.
+	 * @return The number of replayed writes.
+	 */
+	int32 Replay(const FReplayDelegate& Delegate = FReplayDelegate());
+
+	int32 GetPendingCount() const;
+
+	const FString& GetPath() const { return Path; }
+
+private:
+	/** Loads the journal, rewrites it with only the pending writes and opens it for appending */
+	void Open();
+	void WriteLine(const FString& Line);
+	void Answer(const FString& IdempotencyKey, const FString& Field, const FString& Value);
+
+	/** Size of an answered journal from which it is truncated */
+	static constexpr int64 CompactThreshold = 4 * 1024 * 1024;
+
+	FString Path;
+	mutable FCriticalSection Lock;
+	TUniquePtr<IFileHandle> Handle;
+	int64 Size = 0;
+	bool bOpened = false;
+
+	/** Journal line of every unanswered write */
+	TMap<FString, FString> Pending;
+};
@@ -0,0 +1,107 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "ThirdwebMacros.h"
+#include "Containers/Ticker.h"
+#include "Engine/Transaction/ThirdwebEngineStatusStream.h"
+#include "Engine/Transaction/ThirdwebEngineTransactionStatusResult.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "ThirdwebTransactionTracker.generated.h"
+
+/**
+ * Polls the status of many Engine transactions on one shared schedule.
+ *
+ * A transaction is polled every UThirdwebRuntimeSettings::GetEngineTransactionPollInterval() while it is queued or sent,
+ * and after every status change. In any other state that stays the same, such as a status Engine does not report yet,
+ * it backs off towards GetEngineTransactionMaxPollInterval(). Status requests are spread out so that no more than
+ * GetEngineTransactionPollRate() are sent per second in total, earliest due first.
+ *
+ * With UThirdwebRuntimeSettings::IsEngineTransactionStreamingEnabled(), transactions are also subscribed to Engine's status
+ * stream while streams are available. A transaction is not polled while its stream is open, and polling resumes right
+ * away if the stream drops.
+ *
+ * Delegates fire whenever the status of a transaction changes, and tracking stops on its own once the transaction is
+ * mined, errored or cancelled.
+ */
+UCLASS()
+class THIRDWEB_API UThirdwebTransactionTracker : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTransactionStatusChanged, const FString&, QueueId, const FThirdwebEngineTransactionStatusResult&, Result);
+	DECLARE_DELEGATE_OneParam(FStatusDelegate, const FThirdwebEngineTransactionStatusResult& /* Result */)
+
+	/** Overrides */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Fires on every status change of every tracked transaction */
+	UPROPERTY(BlueprintAssignable, Category="Thirdweb|Engine|Transaction")
+	FOnTransactionStatusChanged OnStatusChanged;
+
+	/**
+	 * Starts tracking a transaction. Tracking an already tracked transaction adds the delegates to it.
+	 *
+	 * @param QueueId Queue ID returned by an Engine write.
+	 * @param StatusDelegate Fires on every status change, including the last one.
+	 * @param ErrorDelegate Fires once if the status could not be fetched repeatedly, or if tracking is stopped before the
+	 * transaction reached a terminal status, after which tracking stops.
+	 */
+	void Track(const FString& QueueId, const FStatusDelegate& StatusDelegate, const FStringDelegate& ErrorDelegate);
+
+	UFUNCTION(BlueprintCallable, DisplayName="Track Transaction", Category="Thirdweb|Engine|Transaction")
+	void TrackTransaction(const FString& QueueId);
+
+	/** Stops tracking a transaction. Its error delegates fire, so that whoever waits on its outcome can let go of it */
+	UFUNCTION(BlueprintCallable, DisplayName="Untrack Transaction", Category="Thirdweb|Engine|Transaction")
+	void Untrack(const FString& QueueId);
+
+	UFUNCTION(BlueprintPure, Category="Thirdweb|Engine|Transaction")
+	bool IsTracking(const FString& QueueId) const { return Tracked.Contains(QueueId); }
+
+	UFUNCTION(BlueprintPure, Category="Thirdweb|Engine|Transaction")
+	int32 GetTrackedCount() const { return Tracked.Num(); }
+
+	UFUNCTION(BlueprintPure, meta=(WorldContext="WorldContextObject"), Category="Thirdweb|Engine|Transaction")
+	static UThirdwebTransactionTracker* Get(const UObject* WorldContextObject);
+
+	static bool IsTerminal(const EThirdwebEngineTransactionStatus Status);
+
+private:
+	struct FTrackedTransaction
+	{
+		TArray<FStatusDelegate> StatusDelegates;
+		TArray<FStringDelegate> ErrorDelegates;
+		EThirdwebEngineTransactionStatus Status = EThirdwebEngineTransactionStatus::Unknown;
+		float Interval = 0.0f;
+		double NextPollAt = 0.0;
+		int32 Failures = 0;
+		bool bInFlight = false;
+	};
+
+	/** Consecutive failed polls after which a transaction is given up on */
+	static constexpr int32 MaxFailures = 5;
+
+	bool Tick(float DeltaTime);
+	void Poll(const FString& QueueId, FTrackedTransaction& Transaction);
+	void OnStatus(const FThirdwebEngineTransactionStatusResult& Result, FString QueueId);
+	void OnError(const FString& Error, FString QueueId);
+	void OnStreamStatus(const FString& QueueId, const FThirdwebEngineTransactionStatusResult& Result);
+	void OnStreamDisconnected(const FString& QueueId);
+	void Remove(const FString& QueueId);
+
+	/** Stops tracking a transaction and fires its error delegates with Error */
+	void Abandon(const FString& QueueId, const FString& Error);
+
+	TMap<FString, FTrackedTransaction> Tracked;
+
+	/** Requests that may still be sent before the rate limit is reached */
+	double Budget = 0.0;
+	double LastTickAt = 0.0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	TUniquePtr<FThirdwebEngineStatusStream> Stream;
+};
@@ -0,0 +1,97 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "HAL/CriticalSection.h"
+#include "Misc/IQueuedWork.h"
+#include "Templates/Function.h"
+
+#include <atomic>
+
+class FQueuedThreadPool;
+
+/** Scheduling class of a wallet call. Queued calls of a higher priority always start first */
+enum class EThirdwebFFIPriority : uint8
+{
+	/** Sign in, linking and other calls a player is waiting on */
+	Interactive,
+	/** Signing and wallet management */
+	Normal,
+	/** Queries that refresh state in the background */
+	Background
+};
+
+/**
+ * Runs calls into the Rust library on a dedicated thread pool.
+ *
+ * Most wallet calls block on network I/O for their whole duration, so running them on task graph workers would take
+ * those away from the engine. The pool has UThirdwebRuntimeSettings::GetWalletThreadCount() threads, and calls beyond
+ * that wait in its queue by priority. The module shuts the pool down, after which calls are dropped.
+ */
+class THIRDWEB_API FThirdwebFFIExecutor
+{
+public:
+	static FThirdwebFFIExecutor& Get();
+
+	/** Shorthand for Get().Execute(Priority, Function) */
+	static void Launch(const EThirdwebFFIPriority Priority, TUniqueFunction<void()>&& Function) { Get().Execute(Priority, MoveTemp(Function)); }
+
+	/** Queues Function on the wallet threads. Delegates executed from it run on a wallet thread */
+	void Execute(const EThirdwebFFIPriority Priority, TUniqueFunction<void()>&& Function);
+
+	/** Calls waiting for a thread */
+	int32 GetQueuedCount() const { return Queued.load(); }
+
+	/** Calls waiting for a thread at a priority */
+	int32 GetQueuedCount(const EThirdwebFFIPriority Priority) const { return QueuedByPriority[static_cast<int32>(Priority)].load(); }
+
+	/** Calls running on a thread */
+	int32 GetActiveCount() const { return Active.load(); }
+
+	/** Calls completed since startup */
+	int64 GetCompletedCount() const { return Completed.load(); }
+
+	/**
+	 * Waits for the running calls, abandons the queued ones and destroys the threads. Called from ShutdownModule, as the
+	 * pool must not outlive the engine into static destruction.
+	 */
+	void Shutdown();
+
+	/** Shuts the executor down if it was ever used, without creating it otherwise */
+	static void ShutdownIfCreated();
+
+private:
+	class FWork final : public IQueuedWork
+	{
+	public:
+		FWork(FThirdwebFFIExecutor& InExecutor, const EThirdwebFFIPriority InPriority, TUniqueFunction<void()>&& InFunction)
+			: Executor(InExecutor), Priority(InPriority), Function(MoveTemp(InFunction))
+		{
+		}
+
+		virtual void DoThreadedWork() override;
+		virtual void Abandon() override;
+
+	private:
+		FThirdwebFFIExecutor& Executor;
+		EThirdwebFFIPriority Priority;
+		TUniqueFunction<void()> Function;
+	};
+
+	FThirdwebFFIExecutor();
+
+	static constexpr int32 PriorityCount = 3;
+
+	/** Set once the executor returned by Get() has been constructed */
+	static std::atomic<FThirdwebFFIExecutor*> Instance;
+
+	/** Guards Pool and bShutdown. Never held while waiting on the threads, as running calls may queue more */
+	FRWLock Lock;
+	FQueuedThreadPool* Pool = nullptr;
+	bool bShutdown = false;
+
+	std::atomic<int32> Queued{0};
+	std::atomic<int32> QueuedByPriority[PriorityCount] = {};
+	std::atomic<int32> Active{0};
+	std::atomic<int64> Completed{0};
+};
@@ -0,0 +1,91 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Dom/JsonValue.h"
+#include "Templates/Function.h"
+
+/**
+ * Forward-only JSON reader over raw UTF-8 bytes.
+ *
+ * Values are decoded straight into their destination as the input is walked, without widening the payload to an
+ * FString or building a FJsonObject tree first. Typed reads mirror the HasTypedField checks of the DOM based FromJson
+ * functions: a value of the wrong type is skipped and the destination is left untouched.
+ *
+ * After a syntax error every read fails and Peek returns EJson::None, so decoding loops always terminate.
+ */
+class THIRDWEB_API FThirdwebJsonReader
+{
+public:
+	explicit FThirdwebJsonReader(const TConstArrayView<uint8> InBytes);
+
+	/** Type of the next value. EJson::None at the end of the input or after an error */
+	EJson Peek();
+
+	/**
+	 * Iterates the fields of an object.
+	 *
+	 * @param OnField Called with the key of every field. Should consume the value, which is skipped otherwise.
+	 * @return False if the next value is not an object or is malformed.
+	 */
+	bool ReadObject(TFunctionRef<void(const FUtf8StringView Key)> OnField);
+
+	/**
+	 * Iterates the elements of an array.
+	 *
+	 * @param OnElement Called for every element. Should consume the element, which is skipped otherwise.
+	 * @return False if the next value is not an array or is malformed.
+	 */
+	bool ReadArray(TFunctionRef<void()> OnElement);
+
+	/** Reads an array of objects with T::FromJson(FThirdwebJsonReader&), skipping elements that are not objects */
+	template <typename T>
+	TArray<T> ReadObjectArray()
+	{
+		TArray<T> Values;
+		ReadArray([this, &Values]()
+		{
+			if (Peek() == EJson::Object)
+			{
+				Values.Emplace(T::FromJson(*this));
+			}
+		});
+		return Values;
+	}
+
+	/** Typed reads. Return false and skip the value if it does not have the expected type */
+	bool Read(FString& Out);
+	bool Read(bool& Out);
+	bool Read(double& Out);
+	bool Read(int32& Out);
+	bool Read(int64& Out);
+
+	/** Skips the next value, including everything nested in it */
+	void Skip();
+
+	bool HasError() const { return !Error.IsEmpty(); }
+	const FString& GetError() const { return Error; }
+
+	/** Number of bytes consumed so far */
+	int32 GetOffset() const { return Offset; }
+
+private:
+	void SkipWhitespace();
+	bool Consume(const ANSICHAR Char);
+
+	/** Reads a string token. OutRaw points into the input and is only usable as-is if bOutEscaped is false */
+	bool ReadStringToken(FUtf8StringView& OutRaw, bool& bOutEscaped);
+	bool ReadNumberToken(FUtf8StringView& OutToken);
+	bool ReadLiteral(const ANSICHAR* Literal);
+
+	/** Resolves the escape sequences of a raw string token to UTF-8 */
+	bool Unescape(const FUtf8StringView Raw, TArray<UTF8CHAR>& Out);
+
+	void SetError(const TCHAR* Message);
+
+	const UTF8CHAR* Data;
+	int32 Num;
+	int32 Offset = 0;
+	int32 Depth = 0;
+	FString Error;
+};
@@ -0,0 +1,64 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/ThirdwebSigner.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/Optional.h"
+
+/**
+ * Active signers and admins of a smart wallet, as last fetched from the chain.
+ *
+ * Both sets are indexed by address, so a permission check is a single lookup. They are kept for
+ * UThirdwebRuntimeSettings::GetSmartWalletPermissionCacheTTL() seconds, and dropped as soon as the wallet changes them.
+ * Signer lookups honour the permission window of each signer, so a session key expires from the cache on time.
+ */
+class THIRDWEB_API FThirdwebSmartWalletPermissions
+{
+public:
+	/** Bumped whenever a set is dropped. Read it before fetching and pass it to the setter to drop results that are stale by then */
+	uint32 GetGeneration() const;
+
+	/** Whether the account is known to be deployed, which once true stays true */
+	bool IsDeployed() const;
+
+	void SetDeployed();
+
+	/** The signers active right now, unset if they are not cached */
+	TOptional<TArray<FSigner>> GetActiveSigners() const;
+
+	void SetActiveSigners(const TArray<FSigner>& Signers, const uint32 InGeneration);
+
+	/** Whether Address is a signer active right now, unset if the signers are not cached */
+	TOptional<bool> IsActiveSigner(const FString& Address) const;
+
+	/** Unset if the admins are not cached */
+	TOptional<TArray<FString>> GetAdmins() const;
+
+	void SetAdmins(const TArray<FString>& Admins, const uint32 InGeneration);
+
+	/** Whether Address is an admin, unset if the admins are not cached */
+	TOptional<bool> IsAdmin(const FString& Address) const;
+
+	void InvalidateSigners();
+
+	void InvalidateAdmins();
+
+	/** Whether the permission window of Signer is open at Now. A signer without an end time never expires */
+	static bool IsActiveAt(const FSigner& Signer, const FDateTime& Now) { return Signer.StartTime <= Now && (Signer.EndTime.GetTicks() == 0 || Now < Signer.EndTime); }
+
+private:
+	bool IsFresh(const double FetchedAt) const;
+
+	mutable FRWLock Lock;
+	uint32 Generation = 0;
+	bool bDeployed = false;
+
+	TMap<FString, FSigner> Signers;
+	double SignersFetchedAt = 0.0;
+
+	TSet<FString> Admins;
+	double AdminsFetchedAt = 0.0;
+};
@@ -0,0 +1,44 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Templates/UniquePtr.h"
+
+/**
+ * Owns the UTF-8 copies of the string arguments of an FFI call.
+ *
+ * Strings are converted straight into a fixed inline block, and into larger heap blocks only once that is full, so a
+ * typical call converts all of its arguments without allocating. Blocks never move, so every pointer handed out stays
+ * valid until the arena is destroyed. Declare the arena in the scope of the call, before the call expression.
+ */
+class THIRDWEB_API FThirdwebUtf8Arena
+{
+public:
+	FThirdwebUtf8Arena() = default;
+	FThirdwebUtf8Arena(const FThirdwebUtf8Arena&) = delete;
+	FThirdwebUtf8Arena& operator=(const FThirdwebUtf8Arena&) = delete;
+
+	/** Null terminated UTF-8 copy of String, or nullptr if String is empty as the library expects for absent values */
+	const char* Add(const FString& String);
+
+	/** Array of UTF-8 copies of Strings to pass along with its length, or nullptr if Strings is empty */
+	const char* const* Add(const TArray<FString>& Strings);
+
+	/** Bytes handed out so far */
+	int32 GetUsed() const { return Used; }
+
+private:
+	static constexpr int32 InlineSize = 512;
+	static constexpr int32 MinBlockSize = 4096;
+
+	/** Reserves Size bytes aligned to Alignment, in the current block or in a new one */
+	uint8* Allocate(const int32 Size, const int32 Alignment);
+
+	alignas(alignof(void*)) uint8 Inline[InlineSize];
+	TArray<TUniquePtr<uint8[]>> Blocks;
+	uint8* Cursor = Inline;
+	uint8* End = Inline + InlineSize;
+	int32 Used = 0;
+};
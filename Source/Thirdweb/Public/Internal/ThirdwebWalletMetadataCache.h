@@ -0,0 +1,127 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Map.h"
+#include "Containers/UnrealString.h"
+#include "HAL/CriticalSection.h"
+#include "Internal/ThirdwebSmartWalletPermissions.h"
+#include "Templates/SharedPointer.h"
+#include "Templates/UniquePtr.h"
+#include "Wallets/ThirdwebWalletHandle.h"
+
+#include <atomic>
+
+/**
+ * What is known about a wallet handle without asking the library, and the owner of its native wallet.
+ *
+ * Every copy of a handle points to the same instance, so a value learned through one copy is seen by all of them. Reads
+ * never lock. A value is published once and stays until Invalidate, and published addresses are kept alive with the
+ * instance, so a reader racing an invalidation still copies a complete string.
+ *
+ * The native wallet is freed when the last copy of the handle goes away, or earlier through Release.
+ */
+class THIRDWEB_API FThirdwebWalletMetadata
+{
+public:
+	FThirdwebWalletMetadata(const int64 InID, const FWalletHandle::EWalletHandleType InType);
+	~FThirdwebWalletMetadata();
+
+	int64 GetID() const { return ID; }
+
+	FWalletHandle::EWalletHandleType GetType() const { return Type; }
+
+	/** Bumped by Invalidate. Read it before a library call and pass it to the setter to drop results that are stale by then */
+	uint32 GetGeneration() const { return Generation.load(std::memory_order_acquire); }
+
+	/** Copies the cached address into Address, returns false if none is cached */
+	bool GetAddress(FString& Address) const;
+
+	void SetAddress(const FString& Address, const uint32 InGeneration);
+
+	/** True only once the library has confirmed the wallet is connected */
+	bool IsConnected() const { return bConnected.load(std::memory_order_acquire); }
+
+	void SetConnected(const uint32 InGeneration);
+
+	/** ID of the smart wallet created from this in-app wallet, or of the in-app wallet signing for this smart wallet. Zero if none */
+	int64 GetLinkedWalletID() const { return LinkedWalletID.load(std::memory_order_acquire); }
+
+	void SetLinkedWalletID(const int64 InLinkedWalletID) { LinkedWalletID.store(InLinkedWalletID, std::memory_order_release); }
+
+	/** Keeps the in-app wallet signing for this smart wallet alive for as long as this smart wallet */
+	void SetSigner(const TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe>& InSigner);
+
+	/** Forgets the address and the connection state */
+	void Invalidate();
+
+	/** Frees the native wallet now. Returns false if it was already released */
+	bool Release();
+
+	bool IsReleased() const { return bReleased.load(std::memory_order_acquire); }
+
+	/** Signers and admins of a smart wallet */
+	FThirdwebSmartWalletPermissions& GetPermissions() { return Permissions; }
+
+private:
+	const int64 ID;
+	const FWalletHandle::EWalletHandleType Type;
+
+	std::atomic<const FString*> Address{nullptr};
+	std::atomic<bool> bConnected{false};
+	std::atomic<int64> LinkedWalletID{0};
+	std::atomic<uint32> Generation{0};
+	std::atomic<bool> bReleased{false};
+
+	/** Serializes writers and owns every address published so far */
+	FCriticalSection Lock;
+	TArray<TUniquePtr<FString>> Addresses;
+	TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe> Signer;
+
+	FThirdwebSmartWalletPermissions Permissions;
+};
+
+/**
+ * Process wide registry of wallet metadata, keyed by handle ID.
+ *
+ * The registry only holds weak references, so the metadata, and with it the native wallet, lives exactly as long as
+ * the handles referencing it.
+ */
+class THIRDWEB_API FThirdwebWalletMetadataCache
+{
+	friend class FThirdwebWalletMetadata;
+
+public:
+	static FThirdwebWalletMetadataCache& Get();
+
+	/** The metadata of a live handle, created on first use */
+	TSharedRef<FThirdwebWalletMetadata, ESPMode::ThreadSafe> FindOrAdd(const int64 ID, const FWalletHandle::EWalletHandleType Type);
+
+	/** Records that SmartWalletID was created from InAppWalletID */
+	void Link(const int64 InAppWalletID, const int64 SmartWalletID);
+
+	/** Invalidates the metadata of a handle and of the wallet linked to it */
+	void Invalidate(const int64 ID);
+
+	/** Handles with a native wallet still held */
+	int32 GetLiveCount() const { return Live.load(); }
+
+	/** Native wallets freed since startup */
+	int64 GetFreedCount() const { return Freed.load(); }
+
+	/** Handles registered since startup */
+	int64 GetCreatedCount() const { return Created.load(); }
+
+private:
+	TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe> Find(const int64 ID) const;
+
+	/** Drops the registry entry of a destroyed instance, unless the ID was registered again meanwhile */
+	void Remove(const int64 ID);
+
+	mutable FRWLock Lock;
+	TMap<int64, TWeakPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe>> Entries;
+
+	std::atomic<int32> Live{0};
+	std::atomic<int64> Freed{0};
+	std::atomic<int64> Created{0};
+};
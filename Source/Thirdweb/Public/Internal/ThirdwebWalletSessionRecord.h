@@ -0,0 +1,37 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/UnrealString.h"
+
+/**
+ * The last in-app wallet that signed in, kept next to the wallet storage so the next launch can restore it without
+ * waiting on the network. A record only applies to the client and ecosystem it was saved for.
+ */
+struct THIRDWEB_API FThirdwebWalletSessionRecord
+{
+	/** FInAppWalletHandle::EInAppSource of the wallet */
+	uint8 Source = 0;
+	/** EThirdwebOAuthProvider of the wallet */
+	uint8 Provider = 0;
+	/**
+	 * Email or phone number the wallet was created with, empty for every other source. The native wallet cannot be
+	 * created again without it, and nothing else identifies it. It is kept next to the native wallet storage, which
+	 * already holds the credentials of the session itself, so the record exposes nothing that storage does not.
+	 */
+	FString AuthInput;
+	FString Address;
+
+	/** Reads the record saved for the current settings. Returns false if there is none */
+	static bool Load(FThirdwebWalletSessionRecord& Record);
+
+	void Save() const;
+
+	static void Clear();
+
+private:
+	static FString GetPath();
+
+	/** Identifies the settings a record was saved with */
+	static FString GetScope();
+};
@@ -12,10 +12,15 @@
 #include "ThirdwebMacros.h"
 
 #include "Containers/StringConv.h"
+#include "Containers/StringView.h"
 #include "Containers/UnrealString.h"
 
 #include "HAL/Platform.h"
 
+#include "Templates/Function.h"
+
+class FThirdwebJsonReader;
+
 namespace Thirdweb
 {
 	struct FFIResult
@@ -31,6 +36,12 @@ namespace Thirdweb
 		void Log() const;
 		// Assign's result to output directly
 		FString GetOutput() const;
+		// Borrowed view of the message, only valid until the result is freed
+		FUtf8StringView View() const;
+		// Parses a boolean output straight from the message and then frees the underlying FFIResult
+		bool GetBool() const;
+		// Decodes a JSON output straight from the message and then frees the underlying FFIResult. Error is only converted on failure
+		bool ReadJson(TFunctionRef<void(FThirdwebJsonReader& Reader)> ReadOutput, FString& Error) const;
 	};
 
 	extern "C" {
@@ -61,6 +61,10 @@ public:
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Disconnect"), Category="Thirdweb|Wallets|In App")
 	static void BP_DisconnectWallet(const FInAppWalletHandle& Wallet);
 
+	/** Free the wallet behind the handle now rather than when its last copy is dropped. Invalidates every copy of the handle */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Release"), Category="Thirdweb|Wallets|In App")
+	static void BP_ReleaseInAppWallet(const FInAppWalletHandle& Wallet);
+
 	// Fetch OAuth login link
 	UFUNCTION(BlueprintCallable, meta=(DisplayName="Fetch OAuth Login Link", ExpandEnumAsExecs="ReturnValue"), Category="Thirdweb|Wallets|In App")
 	static EFunctionResult BP_FetchOAuthLoginLink(FInAppWalletHandle Wallet, const FString& RedirectUrl, FString& LoginLink, FString& Error);
@@ -73,6 +77,10 @@ public:
 	UFUNCTION(BlueprintPure, meta=(DisplayName="Is Valid"), Category="Thirdweb|Wallets|Smart")
 	static bool BP_SmartWalletIsValid(const FSmartWalletHandle& Wallet);
 
+	/** Free the wallet behind the handle now rather than when its last copy is dropped. Invalidates every copy of the handle */
+	UFUNCTION(BlueprintCallable, meta=(DisplayName="Release"), Category="Thirdweb|Wallets|Smart")
+	static void BP_ReleaseSmartWallet(const FSmartWalletHandle& Wallet);
+
 	/** Convert a Thirdweb OAuth Provider to Text */
 	UFUNCTION(BlueprintPure, meta=(DisplayName="To Text (Thirdweb OAuth Provider)", CompactNodeTitle="->", BlueprintAutocast), Category="Utilities|Text")
 	static FText Conv_ThirdwebOAuthProviderToText(EThirdwebOAuthProvider Provider);
@@ -134,4 +142,20 @@ public:
 
 	UFUNCTION(BlueprintPure, DisplayName="Get Transaction Receipt Inputs", Category="Utilities|Engine|Transaction Status Result")
 	static void BP_GetTransactionReceiptInputs(const FThirdwebEngineTransactionStatusResult& TransactionStatus, FString& TxHash, int64& ChainID);
+
+	/** Number of Engine requests waiting for an in-flight slot */
+	UFUNCTION(BlueprintPure, DisplayName="Get Engine Queue Depth", Category="Utilities|Engine")
+	static int32 BP_GetEngineQueueDepth();
+
+	/** Number of Engine requests currently in flight */
+	UFUNCTION(BlueprintPure, DisplayName="Get Engine In Flight Count", Category="Utilities|Engine")
+	static int32 BP_GetEngineInFlightCount();
+
+	/** Drops cached Engine read responses of a contract, or every cached response if the address is empty */
+	UFUNCTION(BlueprintCallable, DisplayName="Invalidate Engine Cache", Category="Utilities|Engine")
+	static void BP_InvalidateEngineCache(const FString& ContractAddress);
+
+	/** Sends every journaled Engine write that was never answered again, returning how many were sent */
+	UFUNCTION(BlueprintCallable, DisplayName="Replay Engine Writes", Category="Utilities|Engine")
+	static int32 BP_ReplayEngineWrites();
 };
@@ -58,6 +58,106 @@ protected:
 	/** Access Token for Engine Authorization */
 	UPROPERTY(Config, EditAnywhere, DisplayName="Access Token", meta=(ConfigHierarchyEditable), Category=Engine)
 	FString EngineAccessToken;
+
+	/** Base URLs of additional Engine instances sharing the same access token. Requests are balanced across these and the primary Base URL */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Replica Base URLs", Category=Engine)
+	TArray<FString> EngineReplicaBaseUrls;
+
+	/** Maximum number of Engine requests in flight at once. Additional requests are queued until a slot frees up. 0 = Unlimited */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Max Concurrent Requests", meta=(ClampMin=0, UIMin=0), Category="Engine|Advanced")
+	int32 EngineMaxConcurrentRequests;
+
+	/** Responses at least this large are decoded on a worker thread and only the finished result is handed back to the game thread. 0 = Always */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Async Decode Threshold", meta=(ClampMin=0, UIMin=0, Units="Bytes"), Category="Engine|Advanced")
+	int32 EngineAsyncDecodeThreshold;
+
+	/**
+	 * Seconds to cache successful read responses for, keyed by endpoint (the last URL path segment, e.g. `get-total-count`).
+	 * Endpoints not listed are never cached, and none is by default. A write only invalidates its contract once Engine has
+	 * queued it, not once it is mined, so cached reads may trail recent writes by up to their TTL.
+	 */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Cache TTLs", Category="Engine|Cache")
+	TMap<FString, float> EngineCacheTTLs;
+
+	/** Seconds an expired response may still be served while it is refreshed in the background. 0 = Disabled */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Stale While Revalidate", meta=(ClampMin=0, UIMin=0, Units="s"), Category="Engine|Cache")
+	float EngineCacheStaleWhileRevalidate;
+
+	/** Memory budget of the response cache. 0 = Disabled */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Max Memory (MB)", meta=(ClampMin=0, UIMin=0), Category="Engine|Cache")
+	int32 EngineCacheMaxMemoryMB;
+
+	/** Maximum number of times a failed idempotent request (GETs, and POSTs with an idempotency key) is retried. 0 = Disabled */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Max Retries", meta=(ClampMin=0, UIMin=0, UIMax=10), Category="Engine|Retry")
+	int32 EngineMaxRetries;
+
+	/** Backoff ceiling of the first retry. Doubles on every attempt, and the actual delay is a random fraction of it */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Base Delay", meta=(ClampMin=0, UIMin=0, Units="s"), Category="Engine|Retry")
+	float EngineRetryBaseDelay;
+
+	/** Upper bound of the backoff ceiling */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Max Delay", meta=(ClampMin=0, UIMin=0, Units="s"), Category="Engine|Retry")
+	float EngineRetryMaxDelay;
+
+	/** Consecutive connection failures or 5xx responses after which requests to an Engine host fail fast. 0 = Disabled */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Failure Threshold", meta=(ClampMin=0, UIMin=0), Category="Engine|Circuit Breaker")
+	int32 EngineCircuitBreakerThreshold;
+
+	/** Time an open circuit fails fast before a single probe request is let through */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Cooldown", meta=(ClampMin=0, UIMin=0, Units="s"), Category="Engine|Circuit Breaker")
+	float EngineCircuitBreakerCooldown;
+
+	/** Error rate (0-1, moving average) above which an Engine instance is taken out of rotation */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Ejection Error Rate", meta=(ClampMin=0, ClampMax=1, UIMin=0, UIMax=1), Category="Engine|Load Balancing")
+	float EngineEjectionErrorRate;
+
+	/** Average latency above which an Engine instance is taken out of rotation. 0 = Disabled */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Ejection Latency", meta=(ClampMin=0, UIMin=0, Units="s"), Category="Engine|Load Balancing")
+	float EngineEjectionLatency;
+
+	/** Time an ejected Engine instance stays out of rotation */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Ejection Duration", meta=(ClampMin=0, UIMin=0, Units="s"), Category="Engine|Load Balancing")
+	float EngineEjectionDuration;
+
+	/** Time after which a read that has not completed is also sent to a second Engine instance, using whichever answers first. 0 = Disabled */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Hedge Delay", meta=(ClampMin=0, UIMin=0, Units="s"), Category="Engine|Load Balancing")
+	float EngineHedgeDelay;
+
+	/** Time between status polls of a queued or sent transaction, and after every status change */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Poll Interval", meta=(ClampMin=0.1, UIMin=0.1, Units="s"), Category="Engine|Transaction Tracking")
+	float EngineTransactionPollInterval;
+
+	/** Upper bound of the poll interval of a transaction that is neither queued nor sent and whose status has not changed for a while */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Max Poll Interval", meta=(ClampMin=0.1, UIMin=0.1, Units="s"), Category="Engine|Transaction Tracking")
+	float EngineTransactionMaxPollInterval;
+
+	/** Status requests the transaction tracker may send per second across every tracked transaction. 0 = Unlimited */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Max Requests Per Second", meta=(ClampMin=0, UIMin=0), Category="Engine|Transaction Tracking")
+	float EngineTransactionPollRate;
+
+	/** Receive status updates of tracked transactions over WebSockets, polling only the ones without an open stream */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Stream Status Updates", Category="Engine|Transaction Tracking")
+	bool bEngineTransactionStreaming;
+
+	/** Maximum number of status streams open at once. Engine streams one transaction per connection */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Max Streams", meta=(ClampMin=1, UIMin=1, EditCondition="bEngineTransactionStreaming"), Category="Engine|Transaction Tracking")
+	int32 EngineTransactionMaxStreams;
+
+	/** WebSocket base URL of the status streams, e.g. a local stand-in server. Derived from the Engine Base URL if empty */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Stream Base URL", meta=(EditCondition="bEngineTransactionStreaming"), Category="Engine|Transaction Tracking")
+	FString EngineTransactionStreamBaseUrl;
+
+	/** Time pre-encoded transactions from the same backend wallet are collected before they are submitted together. 0 = Submit immediately */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Batch Window", meta=(ClampMin=0, UIMin=0, UIMax=1, Units="s"), Category="Engine|Write Batching")
+	float EngineWriteBatchWindow;
+
+	/** Writes after which a batch is submitted before its window closes */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Max Batch Size", meta=(ClampMin=1, UIMin=1), Category="Engine|Write Batching")
+	int32 EngineWriteBatchMaxSize;
+
+	/** Record contract writes on disk until Engine answers them, so that writes lost to a crash can be replayed */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Journal Writes", Category="Engine|Write Journal")
+	bool bEngineWriteJournal;
 	
 	/** Opt in or out of connect analytics */
 	UPROPERTY(Config, EditAnywhere, Category=Advanced)
@@ -85,6 +185,22 @@ protected:
 
 	UPROPERTY(Config, EditAnywhere, meta=(EditCondition="bOverrideOAuthBrowserProviderBackends", ArraySizeEnum="EThirdwebOAuthProvider", ConfigHierarchyEditable), Category="Advanced|Wallets")
 	EThirdwebOAuthBrowserBackend OAuthBrowserProviderBackendOverrides[static_cast<int>(EThirdwebOAuthProvider::None)];
+
+	/** Threads dedicated to wallet calls, which block on the network while they run. Read once at first use */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Wallet Threads", meta=(ClampMin=1, UIMin=1, UIMax=16), Category="Advanced|Wallets")
+	int32 WalletThreadCount;
+
+	/** Seconds a wallet session may go unused before the session subsystem drops it. Zero keeps sessions until removed */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Wallet Session Idle Timeout", meta=(ClampMin=0, Units="s"), Category="Advanced|Wallets")
+	float WalletSessionIdleTimeout;
+
+	/** Most wallet sessions held at once. Beyond that the least recently used sessions are dropped. Zero is unlimited */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Max Wallet Sessions", meta=(ClampMin=0), Category="Advanced|Wallets")
+	int32 MaxWalletSessions;
+
+	/** Seconds the signers and admins of a smart wallet are cached. Changes made through the wallet drop them right away. Zero disables the cache */
+	UPROPERTY(Config, EditAnywhere, DisplayName="Smart Wallet Permission Cache TTL", meta=(ClampMin=0, Units="s"), Category="Advanced|Wallets")
+	float SmartWalletPermissionCacheTTL;
 	
 private:
 	static const TArray<EThirdwebOAuthProvider> ExternalOnlyProviders;
@@ -136,9 +252,93 @@ public:
 	/** Static accessor to get BaseEngineUrl */
 	static FString GetEngineBaseUrl();
 	
+	/** Static accessor to get the primary BaseEngineUrl followed by every unique replica */
+	static TArray<FString> GetEngineBaseUrls();
+
 	/** Static accessor to get AccessToken */
 	static FString GetEngineAccessToken();
 
+	/** Static accessor to get EngineMaxConcurrentRequests */
+	static int32 GetEngineMaxConcurrentRequests();
+
+	/** Static accessor to get EngineAsyncDecodeThreshold */
+	static int32 GetEngineAsyncDecodeThreshold();
+
+	/** Static accessor to get the cache TTL of an Engine endpoint. 0 if not cacheable */
+	static float GetEngineCacheTTL(const FString& Endpoint);
+
+	/** Static accessor to get EngineCacheStaleWhileRevalidate */
+	static float GetEngineCacheStaleWhileRevalidate();
+
+	/** Static accessor to get the Engine cache memory budget in bytes */
+	static int64 GetEngineCacheMaxMemory();
+
+	/** Static accessor to get EngineMaxRetries */
+	static int32 GetEngineMaxRetries();
+
+	/** Static accessor to get EngineRetryBaseDelay */
+	static float GetEngineRetryBaseDelay();
+
+	/** Static accessor to get EngineRetryMaxDelay */
+	static float GetEngineRetryMaxDelay();
+
+	/** Static accessor to get EngineCircuitBreakerThreshold */
+	static int32 GetEngineCircuitBreakerThreshold();
+
+	/** Static accessor to get EngineCircuitBreakerCooldown */
+	static float GetEngineCircuitBreakerCooldown();
+
+	/** Static accessor to get EngineEjectionErrorRate */
+	static float GetEngineEjectionErrorRate();
+
+	/** Static accessor to get EngineEjectionLatency */
+	static float GetEngineEjectionLatency();
+
+	/** Static accessor to get EngineEjectionDuration */
+	static float GetEngineEjectionDuration();
+
+	/** Static accessor to get EngineHedgeDelay */
+	static float GetEngineHedgeDelay();
+
+	/** Static accessor to get EngineTransactionPollInterval */
+	static float GetEngineTransactionPollInterval();
+
+	/** Static accessor to get EngineTransactionMaxPollInterval */
+	static float GetEngineTransactionMaxPollInterval();
+
+	/** Static accessor to get EngineTransactionPollRate */
+	static float GetEngineTransactionPollRate();
+
+	/** Static accessor to get bEngineTransactionStreaming */
+	static bool IsEngineTransactionStreamingEnabled();
+
+	/** Static accessor to get EngineTransactionMaxStreams */
+	static int32 GetEngineTransactionMaxStreams();
+
+	/** Static accessor to get EngineTransactionStreamBaseUrl */
+	static FString GetEngineTransactionStreamBaseUrl();
+
+	/** Static accessor to get EngineWriteBatchWindow */
+	static float GetEngineWriteBatchWindow();
+
+	/** Static accessor to get EngineWriteBatchMaxSize */
+	static int32 GetEngineWriteBatchMaxSize();
+
+	/** Static accessor to get bEngineWriteJournal */
+	static bool IsEngineWriteJournalEnabled();
+
+	/** Static accessor to get WalletThreadCount */
+	static int32 GetWalletThreadCount();
+
+	/** Static accessor to get WalletSessionIdleTimeout */
+	static float GetWalletSessionIdleTimeout();
+
+	/** Static accessor to get MaxWalletSessions */
+	static int32 GetMaxWalletSessions();
+
+	/** Static accessor to get SmartWalletPermissionCacheTTL */
+	static float GetSmartWalletPermissionCacheTTL();
+
 	/** Static accessor for AppUri */
 	static FString GetAppUri();
 	
@@ -104,6 +104,7 @@ namespace ThirdwebUtils
 		extern TArray<TSharedPtr<FJsonValue>> ToJsonArray(const FString& String);
 		extern FString ToString(const TSharedPtr<FJsonObject>& JsonObject);
 		extern FString ToString(const TSharedPtr<FJsonValue>& JsonValue);
+		extern FString ToString(const TArray<TSharedPtr<FJsonValue>>& JsonValueArray);
 		extern FString AsString(const TSharedPtr<FJsonValue>& JsonValue);
 		extern bool ParseEngineResponse(const FString& Content, TSharedPtr<FJsonValue>& JsonValue, FString& Error);
 		extern bool ParseEngineResponse(const FString& Content, TSharedPtr<FJsonObject>& JsonObject, FString& Error);
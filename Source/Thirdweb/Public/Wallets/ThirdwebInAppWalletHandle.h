@@ -142,6 +142,21 @@ public:
 	 */
 	static void CreateGuestWallet(const FCreateInAppWalletDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate) { return CreateCustomAuthWallet(Guest, SuccessDelegate, ErrorDelegate); }
 
+	/**
+	 * Restores the wallet of the last session signed in on this device, without waiting on the network.
+	 *
+	 * Every SignInWith* method saves the session on success, whatever the source: OTP, OAuth, JWT, auth endpoint, guest
+	 * and SIWE. Linking another account does not replace it, and dedicated servers never save one.
+	 *
+	 * The handle is returned with the address saved with the session already cached and counts as connected. Whether
+	 * the session is still valid is checked afterward on a background wallet thread.
+	 *
+	 * @param SuccessDelegate Delegate to execute with the restored wallet.
+	 * @param RevalidatedDelegate Delegate to execute with the outcome of the background check. On false the session has expired and the wallet has to sign in again.
+	 * @param ErrorDelegate Delegate to execute if there is no session to restore, or the wallet could not be created.
+	 */
+	static void WarmStart(const FCreateInAppWalletDelegate& SuccessDelegate, const FBoolDelegate& RevalidatedDelegate, const FStringDelegate& ErrorDelegate);
+
 private:
 	/**
 	 * Creates a custom authenticated in-app wallet.
@@ -152,6 +167,12 @@ private:
 	 */
 	static void CreateCustomAuthWallet(const EInAppSource Source, const FCreateInAppWalletDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
 
+	/** Creates the native wallet of a source, returning its ID in Result or the error */
+	static bool CreateNativeWallet(const EInAppSource InSource, const EThirdwebOAuthProvider InProvider, const FString& InAuthInput, FString& Result);
+
+	/** Remembers this wallet as the one to warm start with next launch, once it has signed in */
+	void SaveSession() const;
+
 public:
 	/** Check if the wallet is connected to a session */
 	bool IsConnected() const;
@@ -385,4 +406,6 @@ private:
 	// The current Handle type
 	EInAppSource Source = InvalidSource;
 	EThirdwebOAuthProvider Provider;
+	// Email or phone number the wallet was created with, kept to restore its session
+	FString AuthInput;
 };
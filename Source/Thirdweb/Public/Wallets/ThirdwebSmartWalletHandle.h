@@ -6,7 +6,10 @@
 #include "ThirdwebWalletHandle.h"
 #include "ThirdwebSmartWalletHandle.generated.h"
 
+enum class EThirdwebFFIPriority : uint8;
 struct FSigner;
+struct FThirdwebWalletBootstrapResult;
+class FThirdwebSmartWalletPermissions;
 
 USTRUCT(BlueprintType, Blueprintable)
 struct THIRDWEB_API FSmartWalletHandle : public FWalletHandle
@@ -15,6 +18,7 @@ struct THIRDWEB_API FSmartWalletHandle : public FWalletHandle
 
 	DECLARE_DELEGATE_OneParam(FCreateSmartWalletDelegate, const FSmartWalletHandle&);
 	DECLARE_DELEGATE_OneParam(FGetActiveSignersDelegate, const TArray<FSigner>&);
+	DECLARE_DELEGATE_OneParam(FBootstrapDelegate, const FThirdwebWalletBootstrapResult&);
 	
 	FSmartWalletHandle()
 	{
@@ -28,6 +32,7 @@ private:
 		InAppWallet = InInAppWallet;
 		ensureAlwaysMsgf(InID > 0, TEXT("Invalid id 0"));
 		ID = InID;
+		BindMetadata();
 	}
 
 	explicit FSmartWalletHandle(const FInAppWalletHandle& InInAppWallet, const FString& Int64String);
@@ -55,6 +60,22 @@ public:
 	 */
 	static void Create(const FInAppWalletHandle& InInAppWallet, const int64 ChainID, const bool bGasless, const FString& Factory, const FString& AccountOverride, const FCreateSmartWalletDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
 
+	/**
+	 * Takes a signed in in-app wallet to a ready to use smart wallet in one call.
+	 *
+	 * The in-app wallet address is derived while the smart wallet is created, and the smart wallet address, deploy status
+	 * and active signers are then fetched side by side, so the whole takes about as long as its slowest path.
+	 *
+	 * @param InInAppWallet The signed in in-app wallet.
+	 * @param ChainID Identifier of the blockchain.
+	 * @param bGasless Boolean indicating whether the transaction is gasless.
+	 * @param Factory String identifying the factory contract.
+	 * @param AccountOverride String for account override.
+	 * @param SuccessDelegate Delegate to call with the smart wallet, what was fetched for it and the time every stage took.
+	 * @param ErrorDelegate Delegate to call if the smart wallet could not be created, or its address or deploy status fetched.
+	 */
+	static void Bootstrap(const FInAppWalletHandle& InInAppWallet, const int64 ChainID, const bool bGasless, const FString& Factory, const FString& AccountOverride, const FBootstrapDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
+
 	/** Check if the smart wallet is deployed */
 	void IsDeployed(const FBoolDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
 	
@@ -71,7 +92,7 @@ public:
 	/** Revoke a session key for a smart wallet */
 	void RevokeSessionKey(const FString& Signer, const FSimpleDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
 
-	/** Get the admins of a smart wallet */
+	/** Get the admins of a smart wallet. Served from the permission cache while it is fresh */
 	void GetAdmins(const FStringArrayDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
 
 	/** Add an admin to a smart wallet */
@@ -80,9 +101,27 @@ public:
 	/** Remove an admin from a smart wallet */
 	void RemoveAdmin(const FString& Signer, const FSimpleDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
 
-	/** Get the active signers of a smart wallet */
+	/** Get the active signers of a smart wallet. Served from the permission cache while it is fresh */
 	void GetActiveSigners(const FGetActiveSignersDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
 
+	/**
+	 * Check if an address is a signer of the smart wallet whose permission window is open right now.
+	 *
+	 * Answered right away from the permission cache while it is fresh, otherwise after fetching the deploy status and
+	 * the active signers on a wallet thread. An account that is not deployed has no signers.
+	 *
+	 * @param Signer The address to check.
+	 * @param SuccessDelegate Delegate to call with whether the address is an active signer.
+	 * @param ErrorDelegate Delegate to call if the signers could not be fetched.
+	 */
+	void IsActiveSigner(const FString& Signer, const FBoolDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate) const;
+
 private:
+	/** Create at the priority of the caller, so a bootstrap creates at the priority of its other stages */
+	static void Create(const EThirdwebFFIPriority Priority, const FInAppWalletHandle& InInAppWallet, const int64 ChainID, const bool bGasless, const FString& Factory, const FString& AccountOverride, const FCreateSmartWalletDelegate& SuccessDelegate, const FStringDelegate& ErrorDelegate);
+
+	/** The permission cache shared by all copies of the handle, if it has one */
+	FThirdwebSmartWalletPermissions* GetPermissions() const;
+
 	FInAppWalletHandle InAppWallet;
 };
@@ -33,6 +33,7 @@
 
 struct FSmartWalletHandle;
 struct FInAppWalletHandle;
+class FThirdwebWalletMetadata;
 
 USTRUCT()
 struct THIRDWEB_API FWalletHandle
@@ -58,9 +59,9 @@ struct THIRDWEB_API FWalletHandle
 	/**
 	 * Checks if the wallet handle is valid.
 	 *
-	 * @return True if the wallet handle is valid, i.e., its type is not invalid and its ID is not zero.
+	 * @return True if the wallet handle is valid, i.e., its type is not invalid, its ID is not zero and it was not released.
 	 */
-	virtual bool IsValid() const { return Type != InvalidHandle && ID != 0; }
+	virtual bool IsValid() const;
 
 	/**
 	 * Invalidates the wallet handle, setting its ID to zero and marking its type as invalid.
@@ -69,16 +70,26 @@ struct THIRDWEB_API FWalletHandle
 	{
 		ID = 0;
 		Type = InvalidHandle;
+		Metadata.Reset();
 	}
 
+	/**
+	 * Frees the native wallet behind this handle right away, instead of when the last copy of the handle goes away.
+	 * Every copy of the handle becomes invalid.
+	 */
+	void Release() const;
+
 	/**
 	 * Retrieves the wallet address associated with this handle.
 	 *
+	 * The address is cached for all copies of the handle after the first lookup, until the wallet is disconnected.
+	 *
 	 * @return The wallet address as a string. Returns a zero address if the handle is invalid.
 	 */
 	virtual FString ToAddress() const;
 
-	void CacheAddress();
+	/** Looks up the wallet address ahead of the first ToAddress call */
+	void CacheAddress() const;
 	
 	/**
 	 * Signs a given message using the wallet handle.
@@ -139,8 +150,11 @@ struct THIRDWEB_API FWalletHandle
 		return GetTypeHash(InHandle.GetID());
 	}
 protected:
-	// Cached address to reduce calls
-	FString CachedAddress = TEXT("");
+	/** Resolves the shared metadata of the handle. Call once ID and Type are set */
+	void BindMetadata();
+
+	// Metadata shared by all copies of the handle
+	TSharedPtr<FThirdwebWalletMetadata, ESPMode::ThreadSafe> Metadata;
 	// The current Handle type
 	EWalletHandleType Type = InvalidHandle;
 
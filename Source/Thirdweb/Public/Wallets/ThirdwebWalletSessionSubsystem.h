@@ -0,0 +1,124 @@
+// Copyright (c) 2024 Thirdweb. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Ticker.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Wallets/ThirdwebInAppWalletHandle.h"
+#include "Wallets/ThirdwebSmartWalletHandle.h"
+
+#include <atomic>
+
+#include "ThirdwebWalletSessionSubsystem.generated.h"
+
+USTRUCT(BlueprintType, DisplayName="Wallet Session Stats")
+struct THIRDWEB_API FThirdwebWalletSessionStats
+{
+	GENERATED_BODY()
+
+	/** Sessions currently held */
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Sessions")
+	int32 Sessions = 0;
+
+	/** Sessions dropped after going unused for longer than the idle timeout */
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Sessions")
+	int64 EvictedIdle = 0;
+
+	/** Sessions dropped to stay within the session budget */
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Sessions")
+	int64 EvictedOverBudget = 0;
+
+	/** Approximate bytes held by the session table, not counting the native wallets */
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Sessions")
+	int64 EstimatedBytes = 0;
+
+	/** Native wallets held by the whole process, in or out of sessions */
+	UPROPERTY(BlueprintReadOnly, Category="Thirdweb|Wallets|Sessions")
+	int32 LiveWallets = 0;
+};
+
+/**
+ * Keeps the in-app and smart wallet of every player session of a server.
+ *
+ * The table is split in shards with a lock each, so it can be used from game code and from wallet threads alike
+ * without contending on a single lock. Sessions unused for UThirdwebRuntimeSettings::GetWalletSessionIdleTimeout() are
+ * dropped, and past UThirdwebRuntimeSettings::GetMaxWalletSessions() the least recently used session of the shard
+ * receiving a new one makes room for it. Dropping a session releases its wallets unless they are referenced elsewhere.
+ */
+UCLASS()
+class THIRDWEB_API UThirdwebWalletSessionSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Overrides */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Adds a session, or replaces the wallets of an existing one */
+	UFUNCTION(BlueprintCallable, Category="Thirdweb|Wallets|Sessions")
+	void SetSession(const FString& SessionId, const FInAppWalletHandle& InAppWallet, const FSmartWalletHandle& SmartWallet);
+
+	/** Looks up the wallets of a session and marks it used. Returns false if there is no such session */
+	UFUNCTION(BlueprintCallable, Category="Thirdweb|Wallets|Sessions")
+	bool FindSession(const FString& SessionId, FInAppWalletHandle& InAppWallet, FSmartWalletHandle& SmartWallet);
+
+	/**
+	 * Drops a session.
+	 *
+	 * @param SessionId The session to drop.
+	 * @param bDisconnect Also disconnect the in-app wallet, ending its login.
+	 * @return False if there was no such session.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Thirdweb|Wallets|Sessions")
+	bool RemoveSession(const FString& SessionId, const bool bDisconnect = false);
+
+	/** Drops every session and disconnects their in-app wallets on a wallet thread */
+	UFUNCTION(BlueprintCallable, Category="Thirdweb|Wallets|Sessions")
+	void DisconnectAll();
+
+	/** Drops the sessions that went unused for longer than the idle timeout. Runs on its own periodically */
+	UFUNCTION(BlueprintCallable, Category="Thirdweb|Wallets|Sessions")
+	int32 EvictIdle();
+
+	UFUNCTION(BlueprintPure, Category="Thirdweb|Wallets|Sessions")
+	int32 Num() const { return Count.load(); }
+
+	UFUNCTION(BlueprintPure, Category="Thirdweb|Wallets|Sessions")
+	FThirdwebWalletSessionStats GetStats() const;
+
+	/** Calls Function for every session, one shard at a time with that shard locked */
+	void ForEachSession(TFunctionRef<void(const FString& SessionId, const FInAppWalletHandle& InAppWallet, const FSmartWalletHandle& SmartWallet)> Function) const;
+
+	UFUNCTION(BlueprintPure, meta=(WorldContext="WorldContextObject"), Category="Thirdweb|Wallets|Sessions")
+	static UThirdwebWalletSessionSubsystem* Get(const UObject* WorldContextObject);
+
+private:
+	struct FSession
+	{
+		FInAppWalletHandle InAppWallet;
+		FSmartWalletHandle SmartWallet;
+		double LastUsedAt = 0.0;
+	};
+
+	struct FShard
+	{
+		mutable FCriticalSection Lock;
+		TMap<FString, FSession> Sessions;
+	};
+
+	/** A power of two, so a shard is picked by masking the key hash */
+	static constexpr int32 ShardCount = 64;
+
+	FShard& GetShard(const FString& SessionId) { return Shards[GetTypeHash(SessionId) & (ShardCount - 1)]; }
+
+	bool Tick(float DeltaTime);
+
+	FShard Shards[ShardCount];
+
+	std::atomic<int32> Count{0};
+	std::atomic<int64> EvictedIdle{0};
+	std::atomic<int64> EvictedOverBudget{0};
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -31,6 +31,7 @@ public class Thirdweb : ModuleRules
 	public Thirdweb(ReadOnlyTargetRules target) : base(target)
 	{
 		PrivateDependencyModuleNames.Add("Boost");
+		PrivateDependencyModuleNames.Add("WebSockets");
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 
 #if UE_5_3_OR_LATER